@@ -0,0 +1,39 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace Bench {
+
+// Prevents the compiler from optimising away a computed value.
+template <typename T>
+void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory"); // NOLINT(hicpp-no-assembler)
+}
+
+// Runs body(threadIndex) on the given number of threads and returns the elapsed wall-clock time in nanoseconds.
+template <typename Body>
+auto runThreads(int numThreads, Body body) -> double
+{
+    std::vector<std::thread> threads {};
+    const auto start { std::chrono::steady_clock::now() };
+    for (int t { 0 }; t < numThreads; ++t) {
+        threads.emplace_back([&body, t]() { body(t); });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const auto end { std::chrono::steady_clock::now() };
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+// Prints a single result line in a fixed format.
+inline void report(const char* name, double nanoseconds, std::size_t operations)
+{
+    std::printf("%-48s %10.2f ns/op\n", name, nanoseconds / static_cast<double>(operations));
+}
+
+} // namespace Bench
@@ -0,0 +1,43 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "counter.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 1000000 };
+
+template <typename Body>
+void benchAdd(const char* name, int numThreads, Body body)
+{
+    const double elapsed { Bench::runThreads(numThreads, [&body](int) {
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            body();
+        }
+    }) };
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s (%d threads)", name, numThreads);
+    Bench::report(label, elapsed, iterations);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    for (const int numThreads : { 1, 4 }) {
+        std::atomic<std::int64_t> atomic { 0 };
+        benchAdd("atomic fetch_add", numThreads, [&atomic]() { atomic.fetch_add(1, std::memory_order_relaxed); });
+        Bench::doNotOptimize(atomic.load());
+
+        Blockbuster::Counter<> counter {};
+        benchAdd("counter add", numThreads, [&counter]() { counter.add(); });
+        Bench::doNotOptimize(counter.sum());
+    }
+    return 0;
+}
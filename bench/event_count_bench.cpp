@@ -0,0 +1,43 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "event_count.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 10000000 };
+
+// The producer-side cost of signalling when no consumer is asleep, which is the steady state of a busy queue.
+template <typename Notify>
+void benchNotify(const char* name, Notify notify)
+{
+    const double elapsed { Bench::runThreads(1, [&notify](int) {
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            notify();
+        }
+    }) };
+    Bench::report(name, elapsed, iterations);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    Blockbuster::EventCount events {};
+    benchNotify("eventcount notify (no waiters)", [&events]() { events.notify(); });
+
+    std::mutex mutex {};
+    std::condition_variable condition {};
+    bool ready { false };
+    benchNotify("mutex+condvar notify (no waiters)", [&]() {
+        {
+            const std::lock_guard<std::mutex> lock { mutex };
+            ready = !ready;
+        }
+        condition.notify_one();
+    });
+    Bench::doNotOptimize(ready);
+}
@@ -0,0 +1,41 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "fence.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 10000000 };
+constexpr std::size_t heavyIterations { 100000 };
+
+// A relaxed store followed by a fence and a load, as in publishing a hazard pointer or pinning an epoch.
+template <typename Fence>
+void benchPublish(const char* name, std::size_t count, Fence fence)
+{
+    std::atomic<std::size_t> published { 0 };
+    std::atomic<std::size_t> source { 1 };
+
+    const double elapsed { Bench::runThreads(1, [&](int) {
+        for (std::size_t i { 0 }; i < count; ++i) {
+            published.store(i, std::memory_order_relaxed);
+            fence();
+            Bench::doNotOptimize(source.load(std::memory_order_relaxed));
+        }
+    }) };
+    Bench::report(name, elapsed, count);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    std::printf("asymmetric fences %s\n", Blockbuster::asymmetricFencesAvailable() ? "available" : "unavailable");
+
+    benchPublish("store+load (no fence)", iterations, []() {});
+    benchPublish("store+seq_cst fence+load", iterations, []() { std::atomic_thread_fence(std::memory_order_seq_cst); });
+    benchPublish("store+light fence+load", iterations, []() { Blockbuster::lightFence(); });
+    benchPublish("store+heavy fence+load", heavyIterations, []() { Blockbuster::heavyFence(); });
+}
@@ -0,0 +1,42 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "histogram.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 1000000 };
+
+template <typename Histogram>
+void benchRecord(const char* name, int numThreads)
+{
+    Histogram histogram {};
+    const double elapsed { Bench::runThreads(numThreads, [&histogram](int t) {
+        // A cheap pseudo-random spread of values, so that records hit many buckets.
+        std::uint64_t value { static_cast<std::uint64_t>(t) + 1 };
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            value = value * 6364136223846793005U + 1442695040888963407U;
+            histogram.record(value >> 40);
+        }
+    }) };
+    Bench::doNotOptimize(histogram.snapshot().percentile(99.9));
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s (%d threads)", name, numThreads);
+    Bench::report(label, elapsed, iterations);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    for (const int numThreads : { 1, 4 }) {
+        benchRecord<Blockbuster::Histogram<>>("histogram record", numThreads);
+        benchRecord<Blockbuster::ShardedHistogram<>>("sharded histogram record", numThreads);
+    }
+    return 0;
+}
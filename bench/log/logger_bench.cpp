@@ -0,0 +1,52 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "log/logger.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 100000 };
+
+// Measures only the calling thread's cost: the rings are large enough never to fill, and the background thread is
+// parked on a long poll interval so that it formats and writes to /dev/null after the timed loop.
+template <typename Body>
+void benchLog(const char* name, int numThreads, Body body)
+{
+    std::FILE* sink { std::fopen("/dev/null", "w") };
+    double elapsed {};
+    {
+        Blockbuster::Log::Logger<(1U << 24)> logger { sink, std::chrono::seconds { 1 } };
+        elapsed = Bench::runThreads(numThreads, [&](int) {
+            for (std::size_t i { 0 }; i < iterations; ++i) {
+                Bench::doNotOptimize(body(logger, i));
+            }
+        });
+    }
+    std::fclose(sink);
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s (%d threads)", name, numThreads);
+    Bench::report(label, elapsed, iterations);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    const std::string text { "order-12345" };
+
+    for (const int numThreads : { 1, 4 }) {
+        benchLog("log no arguments", numThreads,
+            [](auto& logger, std::size_t) { return BLOCKBUSTER_LOG(logger, "heartbeat"); });
+        benchLog("log int+double", numThreads,
+            [](auto& logger, std::size_t i) { return BLOCKBUSTER_LOG(logger, "seq %zu px %.4f", i, 101.25); });
+        benchLog("log string", numThreads,
+            [&text](auto& logger, std::size_t i) { return BLOCKBUSTER_LOG(logger, "%s filled %zu", text, i); });
+    }
+    return 0;
+}
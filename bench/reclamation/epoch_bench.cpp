@@ -0,0 +1,81 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "reclamation/epoch.hpp"
+#include "reclamation/hazard_pointer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 1000000 };
+constexpr int numThreads { 4 };
+
+struct Node : Blockbuster::Reclamation::Retirable {
+    explicit Node(std::size_t v)
+        : value { v }
+    {
+    }
+
+    std::size_t value;
+};
+
+// Every thread performs the same mix: readPercent% protected reads, the rest exchange-and-retire writes.
+void benchHazard(std::size_t readPercent)
+{
+    Blockbuster::Reclamation::HazardDomain domain {};
+    std::atomic<Node*> shared { new Node { 0 } };
+
+    const double elapsed { Bench::runThreads(numThreads, [&](int) {
+        auto guard { domain.makeGuard() };
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            if (i % 100 < readPercent) {
+                Bench::doNotOptimize(guard.protect(shared)->value);
+                guard.clear();
+            } else {
+                domain.retire(shared.exchange(new Node { i }));
+            }
+        }
+    }) };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "hazard pointers (%zu%% reads)", readPercent);
+    Bench::report(name, elapsed, iterations);
+    domain.retire(shared.exchange(nullptr));
+}
+
+void benchEpoch(std::size_t readPercent)
+{
+    Blockbuster::Reclamation::EpochDomain domain {};
+    std::atomic<Node*> shared { new Node { 0 } };
+
+    const double elapsed { Bench::runThreads(numThreads, [&](int) {
+        auto participant { domain.makeParticipant() };
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            if (i % 100 < readPercent) {
+                auto pin { participant.pin() };
+                Bench::doNotOptimize(shared.load(std::memory_order_acquire)->value);
+            } else {
+                participant.retire(shared.exchange(new Node { i }));
+            }
+        }
+    }) };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "epochs (%zu%% reads)", readPercent);
+    Bench::report(name, elapsed, iterations);
+    domain.makeParticipant().retire(shared.exchange(nullptr));
+}
+
+} // namespace
+
+auto main() -> int
+{
+    for (const std::size_t readPercent : { 99, 90, 50, 10 }) {
+        benchHazard(readPercent);
+        benchEpoch(readPercent);
+    }
+    return 0;
+}
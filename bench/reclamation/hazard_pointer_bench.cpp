@@ -0,0 +1,108 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "bench.hpp"
+#include "reclamation/hazard_pointer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+constexpr std::size_t iterations { 1000000 };
+
+struct Node : Blockbuster::Reclamation::Retirable {
+    explicit Node(std::size_t v)
+        : value { v }
+    {
+    }
+
+    std::size_t value;
+};
+
+void benchProtect(int numReaders)
+{
+    Blockbuster::Reclamation::HazardDomain domain {};
+    std::atomic<Node*> shared { new Node { 0 } };
+
+    const double elapsed { Bench::runThreads(numReaders, [&](int) {
+        auto guard { domain.makeGuard() };
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            Bench::doNotOptimize(guard.protect(shared)->value);
+            guard.clear();
+        }
+    }) };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "protect+clear (%d readers)", numReaders);
+    Bench::report(name, elapsed, iterations);
+    domain.retire(shared.exchange(nullptr));
+}
+
+void benchRetire()
+{
+    const double baseline { Bench::runThreads(1, [](int) {
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            auto* node { new Node { i } };
+            Bench::doNotOptimize(node);
+            delete node;
+        }
+    }) };
+    Bench::report("new+delete (baseline)", baseline, iterations);
+
+    Blockbuster::Reclamation::HazardDomain domain {};
+    const double elapsed { Bench::runThreads(1, [&](int) {
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            domain.retire(new Node { i });
+        }
+        domain.reclaim();
+    }) };
+    Bench::report("new+retire (amortized reclaim)", elapsed, iterations);
+}
+
+void benchBoundedGarbage(int numReaders, int numWriters)
+{
+    Blockbuster::Reclamation::HazardDomain domain {};
+    std::atomic<Node*> shared { new Node { 0 } };
+    std::atomic<int> writersDone { 0 };
+    std::atomic<std::size_t> maxPending { 0 };
+
+    const double elapsed { Bench::runThreads(numReaders + numWriters, [&](int t) {
+        if (t < numReaders) {
+            auto guard { domain.makeGuard() };
+            while (writersDone.load(std::memory_order_relaxed) < numWriters) {
+                Bench::doNotOptimize(guard.protect(shared)->value);
+                guard.clear();
+            }
+            return;
+        }
+
+        std::size_t localMax { 0 };
+        for (std::size_t i { 0 }; i < iterations; ++i) {
+            domain.retire(shared.exchange(new Node { i }));
+            localMax = std::max(localMax, domain.retiredCount());
+        }
+        std::size_t observed { maxPending.load(std::memory_order_relaxed) };
+        while (observed < localMax && !maxPending.compare_exchange_weak(observed, localMax)) { }
+        writersDone.fetch_add(1, std::memory_order_relaxed);
+    }) };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "exchange+retire (%d readers, %d writers)", numReaders, numWriters);
+    Bench::report(name, elapsed, iterations);
+    std::printf("  max pending garbage %zu (bound %zu + %d racing writers)\n", maxPending.load(), domain.garbageBound(),
+        numWriters);
+    domain.retire(shared.exchange(nullptr));
+}
+
+} // namespace
+
+auto main() -> int
+{
+    benchProtect(1);
+    benchProtect(4);
+    benchRetire();
+    benchBoundedGarbage(4, 1);
+    benchBoundedGarbage(2, 2);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Blockbuster {
+
+/**
+ * @brief Reads the steady clock in nanoseconds.
+ */
+struct SteadyClock {
+    static auto now() -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+};
+
+/**
+ * @brief Reads the CPU's timestamp counter in ticks.
+ *
+ * This is the TSC on x86 and the virtual counter on AArch64; other platforms fall back to the steady clock in
+ * nanoseconds. The counter is not serialising, so nearby reads may be reordered by a few cycles, and it is only
+ * comparable across cores on CPUs with an invariant TSC.
+ */
+struct TscClock {
+    static auto now() -> std::uint64_t
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        std::uint64_t ticks {};
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks)); // NOLINT(hicpp-no-assembler)
+        return ticks;
+#else
+        return SteadyClock::now();
+#endif
+    }
+};
+
+} // namespace Blockbuster
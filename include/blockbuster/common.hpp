@@ -0,0 +1,23 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+namespace Blockbuster {
+
+// Assumed cache line size, used to pad shared state and avoid false sharing.
+constexpr std::size_t cacheLineSize { 64 };
+
+namespace Detail {
+
+    inline std::atomic<std::size_t> nextThreadIndex { 0 };
+
+    // Threads are numbered once so that each one keeps using the same shard of every per-thread structure.
+    inline auto threadIndex() -> std::size_t
+    {
+        static thread_local const std::size_t index { nextThreadIndex.fetch_add(1, std::memory_order_relaxed) };
+        return index;
+    }
+
+} // namespace Detail
+
+} // namespace Blockbuster
@@ -0,0 +1,112 @@
+#pragma once
+#include "common.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Blockbuster {
+
+/**
+ * @brief A concurrent counter that spreads increments over per-thread cells instead of one hot atomic.
+ *
+ * Each thread adds to its own cache-line-padded cell, which is never drained. Once the cell has drifted by the batch
+ * size from the amount already folded, the difference is folded into a shared total, so the total is written at most
+ * once per batch adds. read() returns that total, which is cheap but off by up to Cells * batch; sum() adds up the
+ * cells themselves.
+ *
+ * @tparam Cells The number of cells. Must be a power of 2. Threads beyond this share cells, which stays correct but
+ * brings back some contention.
+ */
+template <std::size_t Cells = 16>
+class Counter {
+public:
+    /**
+     * @brief Constructs a counter at zero.
+     *
+     * @param batchSize How far a cell may drift before it is folded into the total read by read().
+     */
+    explicit Counter(std::int64_t batchSize = s_defaultBatch)
+        : m_batch { std::max<std::int64_t>(batchSize, 1) }
+    {
+    }
+
+    ~Counter() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Counter(const Counter&) = delete;
+    auto operator=(const Counter&) -> Counter& = delete;
+    Counter(Counter&&) = delete;
+    auto operator=(Counter&&) -> Counter& = delete;
+
+    /**
+     * @brief Adds to the counter.
+     *
+     * @param delta The amount to add, which may be negative.
+     */
+    void add(std::int64_t delta = 1)
+    {
+        Cell& cell { m_cells[Detail::threadIndex() & (Cells - 1)] };
+        const std::int64_t value { cell.value.fetch_add(delta, std::memory_order_relaxed) + delta };
+        std::int64_t folded { cell.folded.load(std::memory_order_relaxed) };
+        const std::int64_t drift { value - folded };
+        // Threads sharing the cell may race to fold it; the loser's drift is already covered by the winner's.
+        if ((drift >= m_batch || drift <= -m_batch)
+            && cell.folded.compare_exchange_strong(folded, value, std::memory_order_relaxed)) {
+            m_total.fetch_add(drift, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Subtracts from the counter.
+     *
+     * @param delta The amount to subtract.
+     */
+    void sub(std::int64_t delta = 1)
+    {
+        add(-delta);
+    }
+
+    /**
+     * @brief Returns an approximate value with a single load.
+     *
+     * @return The value, off by at most Cells * batch.
+     */
+    [[nodiscard]] auto read() const -> std::int64_t
+    {
+        return m_total.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the exact value by adding up every cell.
+     *
+     * @return The value.
+     * @note This is exact once concurrent adds have returned; adds in flight may or may not be included.
+     */
+    [[nodiscard]] auto sum() const -> std::int64_t
+    {
+        std::int64_t total { 0 };
+        for (const Cell& cell : m_cells) {
+            total += cell.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    static constexpr std::int64_t s_defaultBatch { 1024 }; // NOLINT(readability-identifier-naming)
+    static_assert(Cells > 0 && (Cells & (Cells - 1)) == 0, "Cells must be greater than 0 and a power of 2");
+
+    // Pad as necessary to avoid false sharing.
+    struct alignas(Blockbuster::cacheLineSize) Cell {
+        std::atomic<std::int64_t> value { 0 };
+        // How much of the value has been folded into the total.
+        std::atomic<std::int64_t> folded { 0 };
+    };
+
+    std::array<Cell, Cells> m_cells {};
+    std::int64_t m_batch;
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::int64_t> m_total { 0 };
+};
+
+} // namespace Blockbuster
@@ -0,0 +1,152 @@
+#pragma once
+#include "common.hpp"
+#include "fence.hpp"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Blockbuster {
+
+/**
+ * @brief An eventcount for adding blocking waits to lock-free structures.
+ *
+ * A consumer that finds nothing to do calls prepareWait(), checks its condition again, and then either calls
+ * cancelWait() if the condition now holds or commitWait() to sleep. A producer makes the condition true and then calls
+ * notify(). Sleeping happens on a futex over an epoch counter that notify() bumps, so a notification that lands
+ * between prepareWait() and commitWait() is never lost.
+ *
+ * When nobody is waiting, notify() is a light fence and a relaxed load of the waiter count. The matching heavy fence
+ * is paid by prepareWait(), which only runs when a consumer is about to sleep.
+ *
+ * @note Each prepareWait() must be followed by exactly one commitWait() or cancelWait() on the same thread.
+ */
+class EventCount {
+public:
+    /**
+     * @brief The epoch observed by prepareWait(), which commitWait() sleeps on.
+     */
+    enum class Key : std::uint32_t {};
+
+    EventCount() = default;
+    ~EventCount() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    EventCount(const EventCount&) = delete;
+    auto operator=(const EventCount&) -> EventCount& = delete;
+    EventCount(EventCount&&) = delete;
+    auto operator=(EventCount&&) -> EventCount& = delete;
+
+    /**
+     * @brief Announces that the calling thread is about to wait. The caller must check its condition again afterwards.
+     *
+     * @return The key to pass to commitWait().
+     */
+    auto prepareWait() -> Key
+    {
+        m_waiters.fetch_add(1, std::memory_order_relaxed);
+        // Order the announcement before the caller's re-check (pairs with the light fence in notify()).
+        Blockbuster::heavyFence();
+        return Key { m_epoch.load(std::memory_order_acquire) };
+    }
+
+    /**
+     * @brief Withdraws a prepareWait() because the condition became true.
+     */
+    void cancelWait()
+    {
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sleeps until notify() is called after the matching prepareWait().
+     *
+     * @param key The key returned by prepareWait().
+     * @note This may return spuriously, so the caller must check its condition again.
+     */
+    void commitWait(Key key)
+    {
+        const auto epoch { static_cast<std::uint32_t>(key) };
+        while (m_epoch.load(std::memory_order_acquire) == epoch) {
+            futex(FUTEX_WAIT_PRIVATE, epoch);
+        }
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Blocks until a condition holds, sleeping between checks.
+     *
+     * @tparam Condition A callable returning bool, typically a non-destructive check or a consuming attempt.
+     * @param condition The condition, which is checked until it returns true.
+     */
+    template <typename Condition>
+    void wait(Condition condition)
+    {
+        while (!condition()) {
+            const Key key { prepareWait() };
+            if (condition()) {
+                cancelWait();
+                return;
+            }
+            commitWait(key);
+        }
+    }
+
+    /**
+     * @brief Wakes one waiting thread, if any. Must be called after making the awaited condition true.
+     */
+    void notify()
+    {
+        // Order the caller's update before the waiter check (pairs with the heavy fence in prepareWait()).
+        Blockbuster::lightFence();
+        if (m_waiters.load(std::memory_order_relaxed) != 0) {
+            wake(1);
+        }
+    }
+
+    /**
+     * @brief Wakes every waiting thread. Must be called after making the awaited condition true.
+     */
+    void notifyAll()
+    {
+        Blockbuster::lightFence();
+        if (m_waiters.load(std::memory_order_relaxed) != 0) {
+            wake(INT_MAX);
+        }
+    }
+
+    /**
+     * @brief Returns the number of threads between prepareWait() and the end of their wait.
+     *
+     * @return The number of waiters.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto waiterCount() const -> std::uint32_t
+    {
+        return m_waiters.load(std::memory_order_relaxed);
+    }
+
+private:
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t)
+            && std::atomic<std::uint32_t>::is_always_lock_free,
+        "The epoch must be usable as a futex word");
+
+    void wake(int count)
+    {
+        m_epoch.fetch_add(1, std::memory_order_release);
+        futex(FUTEX_WAKE_PRIVATE, static_cast<std::uint32_t>(count));
+    }
+
+    void futex(int operation, std::uint32_t value)
+    {
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&m_epoch), operation, value, nullptr, nullptr, 0);
+    }
+
+    // Pad as necessary to avoid false sharing.
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::uint32_t> m_epoch { 0 };
+    std::atomic<std::uint32_t> m_waiters { 0 };
+};
+
+} // namespace Blockbuster
@@ -0,0 +1,135 @@
+#pragma once
+#include "common.hpp"
+#include "fence.hpp"
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <utility>
+
+namespace Blockbuster {
+
+/**
+ * @brief Signals an eventfd when a queue goes from empty to non-empty, so its consumer can live in an epoll or
+ * io_uring event loop.
+ *
+ * The consumer drains the queue whenever the file descriptor becomes readable. Once it finds the queue empty, it calls
+ * arm() and checks the queue again: if that finds more items it calls disarm() and keeps draining, otherwise it
+ * returns to the event loop. Producers call notify() after each enqueue, which writes to the eventfd only if the
+ * consumer is armed, and disarms it in the same step. Steady-state traffic therefore makes no system calls; only the
+ * first item after the consumer ran dry does. A new notifier starts armed, as its consumer has nothing to drain yet.
+ *
+ * notify() costs a light fence and a relaxed load when the consumer is not armed. The matching heavy fence is paid by
+ * arm(), which only runs when the consumer is about to go idle.
+ *
+ * @note The notifier works with any queue, but assumes a single consumer calls acknowledge(), arm() and disarm().
+ */
+class EventFdNotifier {
+public:
+    /**
+     * @brief Creates a notifier with a fresh non-blocking eventfd.
+     *
+     * @return The notifier, or std::nullopt if the eventfd could not be created.
+     */
+    static auto create() -> std::optional<EventFdNotifier>
+    {
+        const int fd { ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        return EventFdNotifier { fd };
+    }
+
+    ~EventFdNotifier()
+    {
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+    }
+
+    EventFdNotifier(const EventFdNotifier&) = delete;
+    auto operator=(const EventFdNotifier&) -> EventFdNotifier& = delete;
+    // Moving is only safe before the notifier is shared with other threads.
+    EventFdNotifier(EventFdNotifier&& other) noexcept
+        : m_armed { other.m_armed.load(std::memory_order_relaxed) }
+        , m_fd { std::exchange(other.m_fd, -1) }
+    {
+    }
+    auto operator=(EventFdNotifier&&) -> EventFdNotifier& = delete;
+
+    /**
+     * @brief Returns the eventfd to register with the event loop for readability.
+     *
+     * @return The file descriptor, which the notifier owns.
+     */
+    [[nodiscard]] auto fd() const -> int
+    {
+        return m_fd;
+    }
+
+    /**
+     * @brief Wakes the consumer if it is armed. Must be called after each enqueue (producers).
+     */
+    void notify()
+    {
+        // Order the caller's enqueue before the armed check (pairs with the heavy fence in arm()).
+        Blockbuster::lightFence();
+        if (m_armed.load(std::memory_order_relaxed) && m_armed.exchange(false, std::memory_order_acq_rel)) {
+            const std::uint64_t one { 1 };
+            static_cast<void>(::write(m_fd, &one, sizeof(one)));
+        }
+    }
+
+    /**
+     * @brief Resets the eventfd after the event loop reported it readable (consumer only).
+     */
+    void acknowledge()
+    {
+        std::uint64_t count {};
+        static_cast<void>(::read(m_fd, &count, sizeof(count)));
+    }
+
+    /**
+     * @brief Asks to be woken by the next notify(). The caller must check the queue again afterwards (consumer only).
+     */
+    void arm()
+    {
+        m_armed.store(true, std::memory_order_relaxed);
+        // Order the flag before the caller's re-check (pairs with the light fence in notify()).
+        Blockbuster::heavyFence();
+    }
+
+    /**
+     * @brief Withdraws an arm() because the re-check found more items (consumer only).
+     *
+     * A producer may already have consumed the arm, in which case the event loop sees one spurious wake-up.
+     */
+    void disarm()
+    {
+        m_armed.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether the consumer is waiting for a notification.
+     *
+     * @return true if armed, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto armed() const -> bool
+    {
+        return m_armed.load(std::memory_order_relaxed);
+    }
+
+private:
+    explicit EventFdNotifier(int fd)
+        : m_fd { fd }
+    {
+    }
+
+    // Pad as necessary to avoid false sharing.
+    alignas(Blockbuster::cacheLineSize) std::atomic<bool> m_armed { true };
+    int m_fd;
+};
+
+} // namespace Blockbuster
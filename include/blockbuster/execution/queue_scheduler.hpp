@@ -0,0 +1,212 @@
+#pragma once
+#include "../common.hpp"
+#include "../event_count.hpp"
+#include "../mpmc/queue.hpp"
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace Blockbuster::Execution {
+
+/**
+ * @brief An execution context whose work items travel through an Mpmc::Queue.
+ *
+ * schedule() returns a sender that, when started, enqueues its own operation state and completes on whichever thread
+ * runs the context. Operation states live inside the pipeline that connected them, so only a pointer goes through
+ * the ring and scheduling never allocates. Any number of threads may call run() or poll(); run() parks on an
+ * EventCount while the ring is empty.
+ *
+ * @tparam Capacity The capacity of the ring. Must be a power of 2.
+ * @note Starting a scheduled operation spins while the ring is full, so size it for the expected backlog. Operations
+ * still queued when the context is destroyed complete with set_stopped().
+ */
+template <std::size_t Capacity>
+class QueueScheduler {
+    struct Task {
+        void (*complete)(Task*, bool stopped) noexcept;
+    };
+
+public:
+    /**
+     * @brief The sender returned by Scheduler::schedule().
+     */
+    class ScheduleSender {
+    public:
+        using ValueType = void;
+
+        template <typename Receiver>
+        class Operation : private Task {
+        public:
+            Operation(QueueScheduler& context, Receiver receiver)
+                : Task { &Operation::complete }
+                , m_context { &context }
+                , m_receiver { std::move(receiver) }
+            {
+            }
+
+            ~Operation() = default;
+
+            // Delete copy and move constructors, as the ring holds a pointer to the operation.
+            Operation(const Operation&) = delete;
+            auto operator=(const Operation&) -> Operation& = delete;
+            Operation(Operation&&) = delete;
+            auto operator=(Operation&&) -> Operation& = delete;
+
+            void start() noexcept
+            {
+                m_context->push(this);
+            }
+
+        private:
+            static void complete(Task* task, bool stopped) noexcept
+            {
+                auto* const operation { static_cast<Operation*>(task) };
+                if (stopped) {
+                    operation->m_receiver.set_stopped();
+                } else {
+                    operation->m_receiver.set_value();
+                }
+            }
+
+            QueueScheduler* m_context;
+            Receiver m_receiver;
+        };
+
+        template <typename Receiver>
+        auto connect(Receiver receiver) && -> Operation<Receiver>
+        {
+            return Operation<Receiver> { *m_context, std::move(receiver) };
+        }
+
+    private:
+        friend class QueueScheduler;
+
+        explicit ScheduleSender(QueueScheduler& context)
+            : m_context { &context }
+        {
+        }
+
+        QueueScheduler* m_context;
+    };
+
+    /**
+     * @brief A lightweight, copyable handle to the context.
+     */
+    class Scheduler {
+    public:
+        /**
+         * @brief Returns a sender that completes on the context.
+         *
+         * @return The sender.
+         */
+        [[nodiscard]] auto schedule() const -> ScheduleSender
+        {
+            return ScheduleSender { *m_context };
+        }
+
+        auto operator==(const Scheduler& other) const -> bool
+        {
+            return m_context == other.m_context;
+        }
+
+        auto operator!=(const Scheduler& other) const -> bool
+        {
+            return m_context != other.m_context;
+        }
+
+    private:
+        friend class QueueScheduler;
+
+        explicit Scheduler(QueueScheduler& context)
+            : m_context { &context }
+        {
+        }
+
+        QueueScheduler* m_context;
+    };
+
+    QueueScheduler() = default;
+
+    ~QueueScheduler()
+    {
+        while (const std::optional<Task*> task { m_tasks.dequeue() }) {
+            (*task)->complete(*task, true);
+        }
+    }
+
+    // Delete copy and move constructors to avoid complications.
+    QueueScheduler(const QueueScheduler&) = delete;
+    auto operator=(const QueueScheduler&) -> QueueScheduler& = delete;
+    QueueScheduler(QueueScheduler&&) = delete;
+    auto operator=(QueueScheduler&&) -> QueueScheduler& = delete;
+
+    /**
+     * @brief Returns a scheduler for the context.
+     *
+     * @return The scheduler.
+     */
+    [[nodiscard]] auto getScheduler() -> Scheduler
+    {
+        return Scheduler { *this };
+    }
+
+    /**
+     * @brief Runs scheduled operations until stop() is called, parking while there are none.
+     */
+    void run()
+    {
+        while (!m_stopping.load(std::memory_order_acquire)) {
+            std::optional<Task*> task {};
+            m_events.wait([this, &task]() {
+                task = m_tasks.dequeue();
+                return task.has_value() || m_stopping.load(std::memory_order_acquire);
+            });
+            if (task) {
+                (*task)->complete(*task, false);
+            }
+        }
+    }
+
+    /**
+     * @brief Runs the operations that are ready, without waiting for more.
+     *
+     * @return The number of operations run.
+     */
+    auto poll() -> std::size_t
+    {
+        std::size_t count { 0 };
+        while (const std::optional<Task*> task { m_tasks.dequeue() }) {
+            (*task)->complete(*task, false);
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Makes every current and future call to run() return once its current operation completes.
+     */
+    void stop()
+    {
+        m_stopping.store(true, std::memory_order_release);
+        m_events.notifyAll();
+    }
+
+private:
+    void push(Task* task)
+    {
+        while (!m_tasks.enqueue(task)) {
+            std::this_thread::yield();
+        }
+        m_events.notify();
+    }
+
+    Mpmc::Queue<Task*, Capacity> m_tasks {};
+    EventCount m_events {};
+
+    // Pad as necessary to avoid false sharing.
+    alignas(Blockbuster::cacheLineSize) std::atomic<bool> m_stopping { false };
+};
+
+} // namespace Blockbuster::Execution
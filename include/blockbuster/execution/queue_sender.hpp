@@ -0,0 +1,149 @@
+#pragma once
+#include <optional>
+#include <utility>
+
+namespace Blockbuster::Execution {
+
+/**
+ * @brief A sender that enqueues an item into a queue when started.
+ *
+ * The operation completes inline on the thread that starts it, so chaining it after a scheduler or another sender
+ * adds no hops and no allocations.
+ *
+ * @tparam Queue The queue type, e.g. Mpmc::Queue<T, Capacity>.
+ * @tparam T The item type.
+ */
+template <typename Queue, typename T>
+class EnqueueSender {
+public:
+    // true if the item was enqueued, false if the queue was full.
+    using ValueType = bool;
+
+    template <typename Receiver>
+    class Operation {
+    public:
+        Operation(Queue& queue, T item, Receiver receiver)
+            : m_queue { &queue }
+            , m_item { std::move(item) }
+            , m_receiver { std::move(receiver) }
+        {
+        }
+
+        ~Operation() = default;
+
+        // Delete copy and move constructors, as receivers may hold pointers to the operation.
+        Operation(const Operation&) = delete;
+        auto operator=(const Operation&) -> Operation& = delete;
+        Operation(Operation&&) = delete;
+        auto operator=(Operation&&) -> Operation& = delete;
+
+        void start() noexcept
+        {
+            m_receiver.set_value(m_queue->enqueue(std::move(m_item)));
+        }
+
+    private:
+        Queue* m_queue;
+        T m_item;
+        Receiver m_receiver;
+    };
+
+    EnqueueSender(Queue& queue, T item)
+        : m_queue { &queue }
+        , m_item { std::move(item) }
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> Operation<Receiver>
+    {
+        return Operation<Receiver> { *m_queue, std::move(m_item), std::move(receiver) };
+    }
+
+private:
+    Queue* m_queue;
+    T m_item;
+};
+
+/**
+ * @brief A sender that dequeues an item from a queue when started.
+ *
+ * The operation completes inline on the thread that starts it, so chaining it after a scheduler or another sender
+ * adds no hops and no allocations.
+ *
+ * @tparam Queue The queue type, e.g. Mpmc::Queue<T, Capacity>.
+ */
+template <typename Queue>
+class DequeueSender {
+public:
+    // The dequeued item, or std::nullopt if the queue was empty.
+    using ValueType = decltype(std::declval<Queue&>().dequeue());
+
+    template <typename Receiver>
+    class Operation {
+    public:
+        Operation(Queue& queue, Receiver receiver)
+            : m_queue { &queue }
+            , m_receiver { std::move(receiver) }
+        {
+        }
+
+        ~Operation() = default;
+
+        // Delete copy and move constructors, as receivers may hold pointers to the operation.
+        Operation(const Operation&) = delete;
+        auto operator=(const Operation&) -> Operation& = delete;
+        Operation(Operation&&) = delete;
+        auto operator=(Operation&&) -> Operation& = delete;
+
+        void start() noexcept
+        {
+            m_receiver.set_value(m_queue->dequeue());
+        }
+
+    private:
+        Queue* m_queue;
+        Receiver m_receiver;
+    };
+
+    explicit DequeueSender(Queue& queue)
+        : m_queue { &queue }
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> Operation<Receiver>
+    {
+        return Operation<Receiver> { *m_queue, std::move(receiver) };
+    }
+
+private:
+    Queue* m_queue;
+};
+
+/**
+ * @brief Creates a sender that enqueues an item into a queue.
+ *
+ * @param queue The queue, which must outlive the operation.
+ * @param item The item to enqueue.
+ * @return The sender, which completes with true if the item was enqueued.
+ */
+template <typename Queue, typename T>
+auto enqueueSender(Queue& queue, T item) -> EnqueueSender<Queue, T>
+{
+    return EnqueueSender<Queue, T> { queue, std::move(item) };
+}
+
+/**
+ * @brief Creates a sender that dequeues an item from a queue.
+ *
+ * @param queue The queue, which must outlive the operation.
+ * @return The sender, which completes with the item or std::nullopt.
+ */
+template <typename Queue>
+auto dequeueSender(Queue& queue) -> DequeueSender<Queue>
+{
+    return DequeueSender<Queue> { queue };
+}
+
+} // namespace Blockbuster::Execution
@@ -0,0 +1,356 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief A minimal sender/receiver model in the style of std::execution (P2300).
+ *
+ * A sender describes work that completes with at most one value. Connecting it to a receiver produces an operation
+ * state, which does nothing until start() is called and must not move in the meantime. The operation completes by
+ * calling exactly one of the receiver's set_value() or set_stopped(). Operation states nest inside each other, so a
+ * whole pipeline is a single object that needs no allocations.
+ *
+ * This is deliberately a subset of P2300: senders declare their single value type as ValueType (void for none), and
+ * there is no set_error(), since the library reports failures as values rather than exceptions. The member names
+ * follow P2300 so that the adaptors carry over once std::execution is available.
+ */
+namespace Blockbuster::Execution {
+
+/**
+ * @brief A sender that completes inline with a value.
+ *
+ * @tparam T The value type.
+ */
+template <typename T>
+class JustSender {
+public:
+    using ValueType = T;
+
+    template <typename Receiver>
+    class Operation {
+    public:
+        Operation(T value, Receiver receiver)
+            : m_value { std::move(value) }
+            , m_receiver { std::move(receiver) }
+        {
+        }
+
+        ~Operation() = default;
+
+        // Delete copy and move constructors, as receivers may hold pointers to the operation.
+        Operation(const Operation&) = delete;
+        auto operator=(const Operation&) -> Operation& = delete;
+        Operation(Operation&&) = delete;
+        auto operator=(Operation&&) -> Operation& = delete;
+
+        void start() noexcept
+        {
+            m_receiver.set_value(std::move(m_value));
+        }
+
+    private:
+        T m_value;
+        Receiver m_receiver;
+    };
+
+    explicit JustSender(T value)
+        : m_value { std::move(value) }
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> Operation<Receiver>
+    {
+        return Operation<Receiver> { std::move(m_value), std::move(receiver) };
+    }
+
+private:
+    T m_value;
+};
+
+/**
+ * @brief Creates a sender that completes inline with a value.
+ *
+ * @param value The value.
+ * @return The sender.
+ */
+template <typename T>
+auto just(T value) -> JustSender<T>
+{
+    return JustSender<T> { std::move(value) };
+}
+
+namespace Detail {
+
+    template <typename Function, typename Value>
+    struct InvokeResult {
+        using Type = std::invoke_result_t<Function, Value>;
+    };
+
+    template <typename Function>
+    struct InvokeResult<Function, void> {
+        using Type = std::invoke_result_t<Function>;
+    };
+
+} // namespace Detail
+
+/**
+ * @brief A sender that transforms the value of another sender on the thread that produced it.
+ *
+ * @tparam Sender The predecessor sender.
+ * @tparam Function The transformation, invoked with the predecessor's value (or nothing if it is void).
+ */
+template <typename Sender, typename Function>
+class ThenSender {
+public:
+    using ValueType = typename Detail::InvokeResult<Function, typename Sender::ValueType>::Type;
+
+    template <typename Receiver>
+    class ThenReceiver {
+    public:
+        ThenReceiver(Function function, Receiver receiver)
+            : m_function { std::move(function) }
+            , m_receiver { std::move(receiver) }
+        {
+        }
+
+        template <typename... Values>
+        void set_value(Values&&... values)
+        {
+            if constexpr (std::is_void_v<ValueType>) {
+                std::invoke(m_function, std::forward<Values>(values)...);
+                m_receiver.set_value();
+            } else {
+                m_receiver.set_value(std::invoke(m_function, std::forward<Values>(values)...));
+            }
+        }
+
+        void set_stopped()
+        {
+            m_receiver.set_stopped();
+        }
+
+    private:
+        Function m_function;
+        Receiver m_receiver;
+    };
+
+    ThenSender(Sender sender, Function function)
+        : m_sender { std::move(sender) }
+        , m_function { std::move(function) }
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) &&
+    {
+        return std::move(m_sender).connect(ThenReceiver<Receiver> { std::move(m_function), std::move(receiver) });
+    }
+
+private:
+    Sender m_sender;
+    Function m_function;
+};
+
+/**
+ * @brief Creates a sender that transforms the value of another sender.
+ *
+ * @param sender The predecessor sender.
+ * @param function The transformation.
+ * @return The sender.
+ */
+template <typename Sender, typename Function>
+auto then(Sender sender, Function function) -> ThenSender<Sender, Function>
+{
+    return ThenSender<Sender, Function> { std::move(sender), std::move(function) };
+}
+
+/**
+ * @brief The pipeable form of then(), as in `sender | then(function)`.
+ */
+template <typename Function>
+struct ThenClosure {
+    Function function;
+};
+
+template <typename Function>
+auto then(Function function) -> ThenClosure<Function>
+{
+    return ThenClosure<Function> { std::move(function) };
+}
+
+template <typename Sender, typename Function>
+auto operator|(Sender sender, ThenClosure<Function> closure) -> ThenSender<Sender, Function>
+{
+    return ThenSender<Sender, Function> { std::move(sender), std::move(closure.function) };
+}
+
+/**
+ * @brief A sender that starts another sender on a scheduler's execution context.
+ *
+ * @tparam Scheduler The scheduler, whose schedule() returns a sender of void.
+ * @tparam Sender The sender to start there.
+ */
+template <typename Scheduler, typename Sender>
+class StartsOnSender {
+public:
+    using ValueType = typename Sender::ValueType;
+
+    template <typename Receiver>
+    class Operation {
+        // Starts the inner operation once the scheduler runs this one.
+        struct StartReceiver {
+            Operation* operation;
+
+            void set_value()
+            {
+                operation->m_inner.start();
+            }
+
+            void set_stopped()
+            {
+                operation->m_receiver.set_stopped();
+            }
+        };
+
+        // Forwards the inner operation's completion to the downstream receiver, which stays here so that a stop
+        // before the inner operation starts can reach it too.
+        struct InnerReceiver {
+            Operation* operation;
+
+            template <typename... Values>
+            void set_value(Values&&... values)
+            {
+                operation->m_receiver.set_value(std::forward<Values>(values)...);
+            }
+
+            void set_stopped()
+            {
+                operation->m_receiver.set_stopped();
+            }
+        };
+
+        using Inner = decltype(std::declval<Sender>().connect(std::declval<InnerReceiver>()));
+        using Schedule = decltype(std::declval<Scheduler&>().schedule().connect(std::declval<StartReceiver>()));
+
+    public:
+        Operation(Scheduler scheduler, Sender sender, Receiver receiver)
+            : m_receiver { std::move(receiver) }
+            , m_inner { std::move(sender).connect(InnerReceiver { this }) }
+            , m_schedule { scheduler.schedule().connect(StartReceiver { this }) }
+        {
+        }
+
+        ~Operation() = default;
+
+        // Delete copy and move constructors, as receivers may hold pointers to the operation.
+        Operation(const Operation&) = delete;
+        auto operator=(const Operation&) -> Operation& = delete;
+        Operation(Operation&&) = delete;
+        auto operator=(Operation&&) -> Operation& = delete;
+
+        void start() noexcept
+        {
+            m_schedule.start();
+        }
+
+    private:
+        Receiver m_receiver;
+        Inner m_inner;
+        Schedule m_schedule;
+    };
+
+    StartsOnSender(Scheduler scheduler, Sender sender)
+        : m_scheduler { std::move(scheduler) }
+        , m_sender { std::move(sender) }
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> Operation<Receiver>
+    {
+        return Operation<Receiver> { std::move(m_scheduler), std::move(m_sender), std::move(receiver) };
+    }
+
+private:
+    Scheduler m_scheduler;
+    Sender m_sender;
+};
+
+/**
+ * @brief Creates a sender that starts another sender on a scheduler's execution context.
+ *
+ * @param scheduler The scheduler.
+ * @param sender The sender to start there.
+ * @return The sender.
+ */
+template <typename Scheduler, typename Sender>
+auto startsOn(Scheduler scheduler, Sender sender) -> StartsOnSender<Scheduler, Sender>
+{
+    return StartsOnSender<Scheduler, Sender> { std::move(scheduler), std::move(sender) };
+}
+
+namespace Detail {
+
+    template <typename T>
+    struct SyncWaitState {
+        std::mutex mutex {};
+        std::condition_variable condition {};
+        bool done { false };
+        std::optional<T> value {};
+    };
+
+    // Completion is signalled under the lock, so the waiting thread cannot destroy the state while it is in use.
+    template <typename T>
+    struct SyncWaitReceiver {
+        SyncWaitState<T>* state;
+
+        template <typename... Values>
+        void set_value(Values&&... values)
+        {
+            const std::lock_guard<std::mutex> lock { state->mutex };
+            state->value.emplace(std::forward<Values>(values)...);
+            state->done = true;
+            state->condition.notify_one();
+        }
+
+        void set_stopped()
+        {
+            const std::lock_guard<std::mutex> lock { state->mutex };
+            state->done = true;
+            state->condition.notify_one();
+        }
+    };
+
+} // namespace Detail
+
+/**
+ * @brief Starts a sender and blocks the calling thread until it completes.
+ *
+ * @param sender The sender.
+ * @return The sender's value, or std::nullopt if it stopped. Senders of void yield true, or false if they stopped.
+ */
+template <typename Sender>
+auto syncWait(Sender sender)
+{
+    using ValueType = typename Sender::ValueType;
+    using Stored = std::conditional_t<std::is_void_v<ValueType>, bool, ValueType>;
+
+    Detail::SyncWaitState<Stored> state {};
+    auto operation { std::move(sender).connect(Detail::SyncWaitReceiver<Stored> { &state }) };
+    operation.start();
+
+    std::unique_lock<std::mutex> lock { state.mutex };
+    state.condition.wait(lock, [&state]() { return state.done; });
+    if constexpr (std::is_void_v<ValueType>) {
+        return state.value.has_value();
+    } else {
+        return std::move(state.value);
+    }
+}
+
+} // namespace Blockbuster::Execution
@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#if defined(__linux__) && !defined(BLOCKBUSTER_DISABLE_MEMBARRIER)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_membarrier) && !defined(BLOCKBUSTER_DISABLE_MEMBARRIER)
+#define BLOCKBUSTER_HAS_MEMBARRIER 1
+#else
+#define BLOCKBUSTER_HAS_MEMBARRIER 0
+#endif
+
+namespace Blockbuster {
+
+namespace Detail {
+
+    inline auto registerMembarrier() -> bool
+    {
+#if BLOCKBUSTER_HAS_MEMBARRIER
+        const long commands { ::syscall(SYS_membarrier, MEMBARRIER_CMD_QUERY, 0, 0) };
+        return commands >= 0 && (commands & MEMBARRIER_CMD_PRIVATE_EXPEDITED) != 0
+            && ::syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+#else
+        return false;
+#endif
+    }
+
+    // Both sides decide once, through the same thread-safe static, so a light fence never relies on a heavy fence that
+    // falls back to a plain one.
+    inline auto membarrierRegistered() -> bool
+    {
+        static const bool registered { registerMembarrier() };
+        return registered;
+    }
+
+} // namespace Detail
+
+/**
+ * @brief Checks whether lightFence() is only a compiler fence.
+ *
+ * This is the case when the kernel supports private expedited membarrier() and the process registered for it. Otherwise
+ * both fences fall back to a sequentially consistent thread fence, which is always correct but gives no savings.
+ *
+ * @return true if asymmetric fences are in use, false otherwise.
+ */
+[[nodiscard]] inline auto asymmetricFencesAvailable() -> bool
+{
+    return Detail::membarrierRegistered();
+}
+
+/**
+ * @brief The cheap half of an asymmetric fence, for the frequently executed side of a Dekker-style handshake.
+ *
+ * Pairs with heavyFence(): for any light fence and heavy fence, either the accesses before the light fence are visible
+ * after the heavy fence, or the accesses before the heavy fence are visible after the light fence, exactly as if both
+ * were sequentially consistent thread fences.
+ */
+inline void lightFence()
+{
+    if (Detail::membarrierRegistered()) {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    } else {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+/**
+ * @brief The expensive half of an asymmetric fence, for the rarely executed side of a Dekker-style handshake.
+ *
+ * Issues a full memory barrier on every CPU currently running a thread of this process, which costs a system call and
+ * an inter-processor interrupt per such CPU.
+ */
+inline void heavyFence()
+{
+#if BLOCKBUSTER_HAS_MEMBARRIER
+    if (Detail::membarrierRegistered()) {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        if (::syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) == 0) {
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            return;
+        }
+    }
+#endif
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+} // namespace Blockbuster
@@ -0,0 +1,351 @@
+#pragma once
+#include "common.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Blockbuster {
+
+namespace Detail {
+
+    // Log-linear bucketing: values below 2^SubBucketBits get a bucket each, and every power-of-2 range above that is
+    // split into 2^(SubBucketBits - 1) equal buckets, indexed by the value's top SubBucketBits bits and how far those
+    // had to be shifted.
+    template <unsigned SubBucketBits>
+    struct HistogramBuckets {
+        static_assert(SubBucketBits >= 2 && SubBucketBits <= 16, "SubBucketBits must be between 2 and 16");
+
+        static constexpr std::uint64_t subBucketCount { std::uint64_t { 1 } << SubBucketBits };
+        static constexpr std::uint64_t halfCount { subBucketCount / 2 };
+        static constexpr std::size_t count { subBucketCount + (64 - SubBucketBits) * halfCount };
+
+        static auto index(std::uint64_t value) -> std::size_t
+        {
+            if (value < subBucketCount) {
+                return static_cast<std::size_t>(value);
+            }
+            const unsigned shift { static_cast<unsigned>(63 - __builtin_clzll(value)) - SubBucketBits + 1 };
+            return static_cast<std::size_t>(subBucketCount + (shift - 1) * halfCount + ((value >> shift) - halfCount));
+        }
+
+        static auto lowestEquivalent(std::size_t index) -> std::uint64_t
+        {
+            if (index < subBucketCount) {
+                return index;
+            }
+            const std::uint64_t offset { index - subBucketCount };
+            return (offset % halfCount + halfCount) << (offset / halfCount + 1);
+        }
+
+        static auto highestEquivalent(std::size_t index) -> std::uint64_t
+        {
+            if (index < subBucketCount) {
+                return index;
+            }
+            const std::uint64_t offset { index - subBucketCount };
+            // Wraps to the maximum value for the very last bucket.
+            return ((offset % halfCount + halfCount + 1) << (offset / halfCount + 1)) - 1;
+        }
+    };
+
+} // namespace Detail
+
+/**
+ * @brief A plain copy of a histogram's counts, for percentile queries and for merging histograms together.
+ *
+ * @tparam SubBucketBits The precision in bits, matching the histogram it was taken from.
+ */
+template <unsigned SubBucketBits = 5>
+class HistogramSnapshot {
+public:
+    HistogramSnapshot() = default;
+
+    /**
+     * @brief Records a value directly into the snapshot.
+     *
+     * @param value The value to record.
+     * @param count The number of times to record it.
+     */
+    void record(std::uint64_t value, std::uint64_t count = 1)
+    {
+        if (count == 0) {
+            return;
+        }
+        m_counts[Buckets::index(value)] += count;
+        m_count += count;
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+    }
+
+    /**
+     * @brief Adds every value in another snapshot to this one.
+     *
+     * @param other The snapshot to merge in.
+     */
+    void merge(const HistogramSnapshot& other)
+    {
+        for (std::size_t i { 0 }; i < Buckets::count; ++i) {
+            m_counts[i] += other.m_counts[i];
+        }
+        m_count += other.m_count;
+        m_min = std::min(m_min, other.m_min);
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    /**
+     * @brief Returns the value at or below which the given percentage of values fall.
+     *
+     * @param percentile The percentile, from 0 to 100 (e.g. 99.9).
+     * @return The highest value equivalent to the percentile's bucket, capped at max(), or 0 if the snapshot is empty.
+     */
+    [[nodiscard]] auto percentile(double percentile) const -> std::uint64_t
+    {
+        if (m_count == 0) {
+            return 0;
+        }
+        // Rounded to the nearest rank so that, e.g., 99.9% of 10000 values is exactly the 9990th despite FP error.
+        const double rank { std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(m_count) };
+        const auto target { std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::llround(rank))) };
+
+        std::uint64_t seen { 0 };
+        for (std::size_t i { 0 }; i < Buckets::count; ++i) {
+            seen += m_counts[i];
+            if (seen >= target) {
+                return std::min(Buckets::highestEquivalent(i), m_max);
+            }
+        }
+        return m_max;
+    }
+
+    /**
+     * @brief Returns the mean of the values, taking each value as the midpoint of its bucket.
+     *
+     * @return The approximate mean, or 0 if the snapshot is empty.
+     */
+    [[nodiscard]] auto mean() const -> double
+    {
+        if (m_count == 0) {
+            return 0;
+        }
+        double total { 0 };
+        for (std::size_t i { 0 }; i < Buckets::count; ++i) {
+            if (m_counts[i] != 0) {
+                const double low { static_cast<double>(Buckets::lowestEquivalent(i)) };
+                const double high { static_cast<double>(Buckets::highestEquivalent(i)) };
+                total += static_cast<double>(m_counts[i]) * (low + (high - low) / 2);
+            }
+        }
+        return total / static_cast<double>(m_count);
+    }
+
+    /**
+     * @brief Returns the number of values.
+     *
+     * @return The number of values.
+     */
+    [[nodiscard]] auto count() const -> std::uint64_t
+    {
+        return m_count;
+    }
+
+    /**
+     * @brief Returns the smallest value.
+     *
+     * @return The smallest value, or 0 if the snapshot is empty.
+     * @note Snapshots taken from a Histogram report the lower bound of that value's bucket.
+     */
+    [[nodiscard]] auto min() const -> std::uint64_t
+    {
+        return m_count == 0 ? 0 : m_min;
+    }
+
+    /**
+     * @brief Returns the largest value.
+     *
+     * @return The largest value, or 0 if the snapshot is empty.
+     * @note Snapshots taken from a Histogram report the upper bound of that value's bucket.
+     */
+    [[nodiscard]] auto max() const -> std::uint64_t
+    {
+        return m_max;
+    }
+
+private:
+    template <unsigned>
+    friend class Histogram;
+
+    using Buckets = Detail::HistogramBuckets<SubBucketBits>;
+
+    std::vector<std::uint64_t> m_counts = std::vector<std::uint64_t>(Buckets::count);
+    std::uint64_t m_count { 0 };
+    std::uint64_t m_min { std::numeric_limits<std::uint64_t>::max() };
+    std::uint64_t m_max { 0 };
+};
+
+/**
+ * @brief A fixed-memory HDR-style histogram of 64-bit values, such as latencies.
+ *
+ * Buckets are log-linear, so any value is recorded with a relative error below 2^-(SubBucketBits - 1) using a few
+ * thousand buckets at most. Recording is a single relaxed fetch_add, so it is wait-free and any number of threads may
+ * record concurrently; queries go through snapshot(). The extremes are not tracked separately: snapshots take min()
+ * and max() from the bounds of the lowest and highest non-empty buckets, which is within the same relative error.
+ * Under heavy contention from many threads, prefer ShardedHistogram.
+ *
+ * @tparam SubBucketBits The precision in bits. 5 (the default) bounds the error at 6.25%, 8 at 0.8%.
+ */
+template <unsigned SubBucketBits = 5>
+class Histogram {
+public:
+    Histogram() = default;
+    ~Histogram() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Histogram(const Histogram&) = delete;
+    auto operator=(const Histogram&) -> Histogram& = delete;
+    Histogram(Histogram&&) = delete;
+    auto operator=(Histogram&&) -> Histogram& = delete;
+
+    /**
+     * @brief Records a value.
+     *
+     * @param value The value to record.
+     */
+    void record(std::uint64_t value)
+    {
+        m_counts[Buckets::index(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the counts into a snapshot.
+     *
+     * @return The snapshot.
+     * @note Values recorded during the copy may or may not be included, so the snapshot is not atomic and should
+     * only be used for monitoring.
+     */
+    [[nodiscard]] auto snapshot() const -> HistogramSnapshot<SubBucketBits>
+    {
+        HistogramSnapshot<SubBucketBits> snapshot {};
+        addTo(snapshot);
+        return snapshot;
+    }
+
+    /**
+     * @brief Adds the counts to an existing snapshot, e.g. to merge several histograms without intermediate copies.
+     *
+     * @param snapshot The snapshot to add to.
+     */
+    void addTo(HistogramSnapshot<SubBucketBits>& snapshot) const
+    {
+        std::uint64_t count { 0 };
+        std::size_t lowest { 0 };
+        std::size_t highest { 0 };
+        for (std::size_t i { 0 }; i < Buckets::count; ++i) {
+            const std::uint64_t bucket { m_counts[i].load(std::memory_order_relaxed) };
+            if (bucket != 0) {
+                lowest = count == 0 ? i : lowest;
+                highest = i;
+            }
+            snapshot.m_counts[i] += bucket;
+            count += bucket;
+        }
+        if (count != 0) {
+            snapshot.m_count += count;
+            snapshot.m_min = std::min(snapshot.m_min, Buckets::lowestEquivalent(lowest));
+            snapshot.m_max = std::max(snapshot.m_max, Buckets::highestEquivalent(highest));
+        }
+    }
+
+    /**
+     * @brief Clears every count.
+     *
+     * @note Values recorded concurrently may be partially kept, so this should only be used between measurements.
+     */
+    void reset()
+    {
+        for (auto& count : m_counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    using Buckets = Detail::HistogramBuckets<SubBucketBits>;
+
+    std::array<std::atomic<std::uint64_t>, Buckets::count> m_counts {};
+};
+
+/**
+ * @brief A Histogram split into per-thread shards, so that concurrent recording never contends.
+ *
+ * Each thread records into its own cache-line-aligned shard; snapshot() merges them.
+ *
+ * @tparam Shards The number of shards. Must be a power of 2. Threads beyond this share shards, which stays correct
+ * but brings back some contention.
+ * @tparam SubBucketBits The precision in bits.
+ */
+template <std::size_t Shards = 16, unsigned SubBucketBits = 5>
+class ShardedHistogram {
+public:
+    ShardedHistogram() = default;
+    ~ShardedHistogram() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    ShardedHistogram(const ShardedHistogram&) = delete;
+    auto operator=(const ShardedHistogram&) -> ShardedHistogram& = delete;
+    ShardedHistogram(ShardedHistogram&&) = delete;
+    auto operator=(ShardedHistogram&&) -> ShardedHistogram& = delete;
+
+    /**
+     * @brief Records a value in the calling thread's shard.
+     *
+     * @param value The value to record.
+     */
+    void record(std::uint64_t value)
+    {
+        m_shards[Detail::threadIndex() & (Shards - 1)].histogram.record(value);
+    }
+
+    /**
+     * @brief Merges every shard into a snapshot.
+     *
+     * @return The snapshot.
+     * @note Values recorded during the copy may or may not be included, so the snapshot is not atomic and should
+     * only be used for monitoring.
+     */
+    [[nodiscard]] auto snapshot() const -> HistogramSnapshot<SubBucketBits>
+    {
+        HistogramSnapshot<SubBucketBits> snapshot {};
+        for (const Shard& shard : m_shards) {
+            shard.histogram.addTo(snapshot);
+        }
+        return snapshot;
+    }
+
+    /**
+     * @brief Clears every shard.
+     *
+     * @note Values recorded concurrently may be partially kept, so this should only be used between measurements.
+     */
+    void reset()
+    {
+        for (Shard& shard : m_shards) {
+            shard.histogram.reset();
+        }
+    }
+
+private:
+    static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "Shards must be greater than 0 and a power of 2");
+
+    // Pad as necessary to avoid false sharing.
+    struct alignas(Blockbuster::cacheLineSize) Shard {
+        Histogram<SubBucketBits> histogram {};
+    };
+
+    std::array<Shard, Shards> m_shards {};
+};
+
+} // namespace Blockbuster
@@ -0,0 +1,502 @@
+#pragma once
+#include "common.hpp"
+#include "shared_memory.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <optional>
+#include <string>
+#include <sys/file.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace Blockbuster {
+
+/**
+ * @brief An append-only persistent queue of variable-length records in memory-mapped files.
+ *
+ * Records are written straight into mapped file pages with the same reserve/commit pattern as Spsc::ByteQueue: an
+ * 8-byte header (stride and size) is published with a release store after the payload, so readers in any process see
+ * either nothing or a complete record. Nothing is ever consumed. Each record has a global index, and readers (Tailer)
+ * can start from any index and follow the appender live. When a file is full the appender writes a roll marker and
+ * continues in the next file ("cycle"), so old cycles can be archived or deleted independently.
+ *
+ * There is a single Appender per journal directory (enforced with a file lock) and any number of Tailers.
+ *
+ * @tparam FileSize The size of each cycle file in bytes. Must be a multiple of 8.
+ * @note Durability follows the page cache: committed records survive a process crash, and Appender::sync() makes them
+ * survive a power failure.
+ */
+template <std::size_t FileSize = (1U << 26)>
+class Journal {
+    struct FileHeader {
+        SharedHeader header;
+        std::uint64_t firstIndex;
+    };
+
+public:
+    /**
+     * @brief A view of a record's payload inside a mapped file.
+     */
+    struct Record {
+        const std::byte* data;
+        std::size_t size;
+        std::uint64_t index;
+    };
+
+    /**
+     * @brief The single writer of a journal.
+     */
+    class Appender {
+    public:
+        ~Appender()
+        {
+            if (m_lockFd >= 0) {
+                ::close(m_lockFd);
+            }
+        }
+
+        Appender(const Appender&) = delete;
+        auto operator=(const Appender&) -> Appender& = delete;
+        Appender(Appender&& other) noexcept
+            : m_journal { other.m_journal }
+            , m_lockFd { std::exchange(other.m_lockFd, -1) }
+            , m_file { std::move(other.m_file) }
+            , m_cycle { other.m_cycle }
+            , m_position { other.m_position }
+            , m_nextIndex { other.m_nextIndex }
+        {
+        }
+        auto operator=(Appender&&) -> Appender& = delete;
+
+        /**
+         * @brief Reserves contiguous space for a record, rolling to a new cycle file if necessary.
+         *
+         * @param size The maximum payload size the caller intends to write.
+         * @return A pointer to at least size writable bytes, or nullptr if the record is too large or a new cycle
+         * file could not be created.
+         * @note Each successful reserve() must be followed by a commit() before the next reserve().
+         */
+        auto reserve(std::size_t size) -> std::byte*
+        {
+            if (size > maxRecordSize()) {
+                return nullptr;
+            }
+            if (m_position + strideOf(size) + s_headerSize > FileSize && !roll()) {
+                return nullptr;
+            }
+            return bytes(*m_file) + m_position + s_headerSize;
+        }
+
+        /**
+         * @brief Publishes the record previously reserved.
+         *
+         * @param size The number of bytes actually written, which must not exceed the reserved size.
+         * @return The index of the record.
+         */
+        auto commit(std::size_t size) -> std::uint64_t
+        {
+            header(*m_file, m_position).store(pack(strideOf(size), size), std::memory_order_release);
+            m_position += strideOf(size);
+            return m_nextIndex++;
+        }
+
+        /**
+         * @brief Copies a record into the journal.
+         *
+         * @param data The payload to copy.
+         * @param size The payload size in bytes.
+         * @return The index of the record, or std::nullopt if it could not be appended.
+         */
+        auto append(const void* data, std::size_t size) -> std::optional<std::uint64_t>
+        {
+            std::byte* const destination { reserve(size) };
+            if (destination == nullptr) {
+                return std::nullopt;
+            }
+            std::memcpy(destination, data, size);
+            return commit(size);
+        }
+
+        /**
+         * @brief Flushes the current cycle file to storage.
+         *
+         * @return true if the file was flushed, false otherwise.
+         */
+        auto sync() -> bool
+        {
+            return m_file->sync();
+        }
+
+        /**
+         * @brief Returns the index the next committed record will have.
+         *
+         * @return The next index.
+         */
+        [[nodiscard]] auto nextIndex() const -> std::uint64_t
+        {
+            return m_nextIndex;
+        }
+
+    private:
+        friend class Journal;
+
+        Appender(const Journal& journal, int lockFd)
+            : m_journal { &journal }
+            , m_lockFd { lockFd }
+        {
+        }
+
+        // The roll marker is written before the next file exists, so a crash in between is repaired on reopen and
+        // tailers simply wait for the file to appear.
+        auto roll() -> bool
+        {
+            if (m_position < FileSize) {
+                header(*m_file, m_position).store(pack(0, s_rollMarker), std::memory_order_release);
+                m_position = FileSize;
+            }
+            std::optional<SharedMemory> next { m_journal->createCycle(m_cycle + 1, m_nextIndex) };
+            if (!next) {
+                return false;
+            }
+            m_file = std::move(next);
+            ++m_cycle;
+            m_position = s_dataOffset;
+            return true;
+        }
+
+        const Journal* m_journal;
+        int m_lockFd;
+        std::optional<SharedMemory> m_file {};
+        std::uint64_t m_cycle { 0 };
+        std::size_t m_position { s_dataOffset };
+        std::uint64_t m_nextIndex { 0 };
+    };
+
+    /**
+     * @brief A reader that follows the journal from any index. Tailers never modify the journal.
+     */
+    class Tailer {
+    public:
+        /**
+         * @brief Returns the next record and advances past it.
+         *
+         * @return A view of the record, valid until the next call to read() or seek(), or std::nullopt if no further
+         * record has been committed yet.
+         */
+        auto read() -> std::optional<Record>
+        {
+            if (!m_file && !open(m_cycle)) {
+                return std::nullopt;
+            }
+
+            for (;;) {
+                const std::uint64_t word { header(*m_file, m_position).load(std::memory_order_acquire) };
+                if (word == 0) {
+                    return std::nullopt;
+                }
+                const auto size { static_cast<std::uint32_t>(word) };
+                if (size == s_rollMarker) {
+                    if (!open(m_cycle + 1)) {
+                        return std::nullopt;
+                    }
+                    continue;
+                }
+
+                const Record record { bytes(*m_file) + m_position + s_headerSize, size, m_index++ };
+                m_position += static_cast<std::size_t>(word >> 32);
+                return record;
+            }
+        }
+
+        /**
+         * @brief Positions the tailer so that the next read() returns the record with the given index.
+         *
+         * @param index The index to move to.
+         * @return true if the tailer is positioned at the index, false if the index has not been written yet (the
+         * tailer is then positioned at the end of the journal) or has been deleted.
+         */
+        auto seek(std::uint64_t index) -> bool
+        {
+            const std::vector<std::uint64_t> cycles { m_journal->cycles() };
+            // Find the last cycle starting at or before the index.
+            auto found { std::upper_bound(cycles.begin(), cycles.end(), index, [this](std::uint64_t target, std::uint64_t cycle) {
+                const std::optional<SharedMemory> file { m_journal->openCycle(cycle) };
+                return file && target < firstIndexOf(*file);
+            }) };
+            if (found == cycles.begin() || !open(*std::prev(found))) {
+                return false;
+            }
+
+            while (m_index < index) {
+                const std::uint64_t word { header(*m_file, m_position).load(std::memory_order_acquire) };
+                if (word == 0 || static_cast<std::uint32_t>(word) == s_rollMarker) {
+                    return false;
+                }
+                m_position += static_cast<std::size_t>(word >> 32);
+                ++m_index;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Positions the tailer after the last committed record.
+         */
+        void toEnd()
+        {
+            static_cast<void>(seek(std::numeric_limits<std::uint64_t>::max()));
+        }
+
+        /**
+         * @brief Returns the index the next read() will return.
+         *
+         * @return The next index, or 0 if no cycle file has been opened yet.
+         */
+        [[nodiscard]] auto index() const -> std::uint64_t
+        {
+            return m_index;
+        }
+
+    private:
+        friend class Journal;
+
+        Tailer(const Journal& journal, std::uint64_t cycle)
+            : m_journal { &journal }
+            , m_cycle { cycle }
+        {
+        }
+
+        auto open(std::uint64_t cycle) -> bool
+        {
+            std::optional<SharedMemory> file { m_journal->openCycle(cycle) };
+            if (!file) {
+                return false;
+            }
+            m_file = std::move(file);
+            m_cycle = cycle;
+            m_position = s_dataOffset;
+            m_index = firstIndexOf(*m_file);
+            return true;
+        }
+
+        const Journal* m_journal;
+        std::optional<SharedMemory> m_file {};
+        std::uint64_t m_cycle;
+        std::size_t m_position { s_dataOffset };
+        std::uint64_t m_index { 0 };
+    };
+
+    /**
+     * @brief Constructs a journal over a directory of cycle files.
+     *
+     * @param directory The directory holding the cycle files. Created by makeAppender() if it does not exist.
+     */
+    explicit Journal(std::string directory)
+        : m_directory { std::move(directory) }
+    {
+    }
+
+    ~Journal() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Journal(const Journal&) = delete;
+    auto operator=(const Journal&) -> Journal& = delete;
+    Journal(Journal&&) = delete;
+    auto operator=(Journal&&) -> Journal& = delete;
+
+    /**
+     * @brief Opens the journal for writing, resuming after the last committed record.
+     *
+     * @return The appender, or std::nullopt if another appender holds the journal or its files could not be opened.
+     * @note The journal must outlive the appender.
+     */
+    auto makeAppender() const -> std::optional<Appender>
+    {
+        std::error_code error {};
+        std::filesystem::create_directories(m_directory, error);
+        const int lockFd { ::open((m_directory + "/appender.lock").c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644) };
+        if (lockFd < 0) {
+            return std::nullopt;
+        }
+        if (::flock(lockFd, LOCK_EX | LOCK_NB) != 0) {
+            ::close(lockFd);
+            return std::nullopt;
+        }
+
+        Appender appender { *this, lockFd };
+        std::vector<std::uint64_t> cycles { this->cycles() };
+        std::optional<SharedMemory> file {};
+        if (!cycles.empty()) {
+            file = openCycle(cycles.back());
+            // A crash while creating the newest cycle leaves a file that was never published, so resume before it.
+            // Only the first cycle can be recreated from scratch, as later ones need their predecessor's last index.
+            // Files of another size or layout may hold committed data, so those are never touched.
+            if (!file && (cycles.size() > 1 || cycles.back() == 0) && unpublished(cycles.back())) {
+                std::filesystem::remove(pathOf(cycles.back()), error);
+                cycles.pop_back();
+                if (!cycles.empty()) {
+                    file = openCycle(cycles.back());
+                }
+            }
+        }
+        if (cycles.empty()) {
+            file = createCycle(0, 0);
+            if (!file) {
+                return std::nullopt;
+            }
+            appender.m_file = std::move(file);
+            return appender;
+        }
+        if (!file) {
+            return std::nullopt;
+        }
+        appender.m_file = std::move(file);
+        appender.m_cycle = cycles.back();
+        appender.m_nextIndex = firstIndexOf(*appender.m_file);
+
+        // Resume after the last committed record; anything after it was never published.
+        for (;;) {
+            const std::uint64_t word { header(*appender.m_file, appender.m_position).load(std::memory_order_acquire) };
+            if (word == 0) {
+                break;
+            }
+            if (static_cast<std::uint32_t>(word) == s_rollMarker) {
+                appender.m_position = FileSize;
+                break;
+            }
+            appender.m_position += static_cast<std::size_t>(word >> 32);
+            ++appender.m_nextIndex;
+        }
+        if (appender.m_position == FileSize && !appender.roll()) {
+            return std::nullopt;
+        }
+        return appender;
+    }
+
+    /**
+     * @brief Creates a tailer positioned at the oldest record still on disk.
+     *
+     * @return The tailer.
+     * @note The journal must outlive the tailer.
+     */
+    auto makeTailer() const -> Tailer
+    {
+        const std::vector<std::uint64_t> cycles { this->cycles() };
+        return Tailer { *this, cycles.empty() ? 0 : cycles.front() };
+    }
+
+    /**
+     * @brief Returns the largest payload a single record can hold.
+     *
+     * @return The maximum record size in bytes.
+     */
+    [[nodiscard]] static constexpr auto maxRecordSize() -> std::size_t
+    {
+        return FileSize - s_dataOffset - 2 * s_headerSize;
+    }
+
+private:
+    // Every cycle file starts with a cache line holding its header. A record is only placed where a roll marker still
+    // fits after it, so the appender can always mark the end of a file.
+    static constexpr std::size_t s_dataOffset { Blockbuster::cacheLineSize }; // NOLINT(readability-identifier-naming)
+    static constexpr std::size_t s_headerSize { 8 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint32_t s_rollMarker { std::numeric_limits<std::uint32_t>::max() }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint64_t s_magic { 0x424C4B4A524E4C51 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint32_t s_version { 1 }; // NOLINT(readability-identifier-naming)
+    static_assert(FileSize % s_headerSize == 0 && FileSize >= 4 * s_dataOffset, "FileSize must be a multiple of 8 and at least 256");
+    static_assert(FileSize <= std::numeric_limits<std::uint32_t>::max(), "FileSize must fit record strides in 32 bits");
+    static_assert(sizeof(FileHeader) <= s_dataOffset);
+
+    // Header plus payload, rounded up so that every header stays 8-byte aligned.
+    [[nodiscard]] static constexpr auto strideOf(std::size_t size) -> std::size_t
+    {
+        return (s_headerSize + size + s_headerSize - 1) & ~(s_headerSize - 1);
+    }
+
+    [[nodiscard]] static constexpr auto pack(std::size_t stride, std::size_t size) -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(stride) << 32) | static_cast<std::uint32_t>(size);
+    }
+
+    static auto bytes(const SharedMemory& file) -> std::byte*
+    {
+        return static_cast<std::byte*>(file.data());
+    }
+
+    // Headers are accessed atomically in place; files are page aligned and every header offset is a multiple of 8.
+    static auto header(const SharedMemory& file, std::size_t offset) -> std::atomic<std::uint64_t>&
+    {
+        return *reinterpret_cast<std::atomic<std::uint64_t>*>(bytes(file) + offset); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    static auto firstIndexOf(const SharedMemory& file) -> std::uint64_t
+    {
+        return static_cast<const FileHeader*>(file.data())->firstIndex;
+    }
+
+    [[nodiscard]] auto pathOf(std::uint64_t cycle) const -> std::string
+    {
+        std::array<char, 32> name {};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        std::snprintf(name.data(), name.size(), "/%016llx.cycle", static_cast<unsigned long long>(cycle)); // NOLINT(google-runtime-int)
+        return m_directory + name.data();
+    }
+
+    // Returns the cycles present on disk in ascending order.
+    [[nodiscard]] auto cycles() const -> std::vector<std::uint64_t>
+    {
+        std::vector<std::uint64_t> cycles {};
+        std::error_code error {};
+        for (const auto& entry : std::filesystem::directory_iterator { m_directory, error }) {
+            const std::filesystem::path& path { entry.path() };
+            if (path.extension() == ".cycle") {
+                cycles.push_back(std::strtoull(path.stem().c_str(), nullptr, 16));
+            }
+        }
+        std::sort(cycles.begin(), cycles.end());
+        return cycles;
+    }
+
+    [[nodiscard]] auto createCycle(std::uint64_t cycle, std::uint64_t firstIndex) const -> std::optional<SharedMemory>
+    {
+        std::optional<SharedMemory> file { SharedMemory::createFile(pathOf(cycle).c_str(), FileSize) };
+        if (file) {
+            auto* fileHeader { new (file->data()) FileHeader };
+            fileHeader->firstIndex = firstIndex;
+            fileHeader->header.publish(s_magic, s_version, 1, FileSize);
+        }
+        return file;
+    }
+
+    [[nodiscard]] auto openCycle(std::uint64_t cycle) const -> std::optional<SharedMemory>
+    {
+        std::optional<SharedMemory> file { SharedMemory::openFile(pathOf(cycle).c_str(), FileSize) };
+        if (!file || !static_cast<const FileHeader*>(file->data())->header.matches(s_magic, s_version, 1, FileSize)) {
+            return std::nullopt;
+        }
+        return file;
+    }
+
+    // Checks whether a cycle file has the expected size but a header that was never published.
+    [[nodiscard]] auto unpublished(std::uint64_t cycle) const -> bool
+    {
+        const std::optional<SharedMemory> file { SharedMemory::openFile(pathOf(cycle).c_str(), FileSize) };
+        return file && static_cast<const FileHeader*>(file->data())->header.ready.load(std::memory_order_acquire) == 0;
+    }
+
+    std::string m_directory;
+};
+
+} // namespace Blockbuster
@@ -0,0 +1,452 @@
+#pragma once
+#include "../spsc/byte_queue.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Logs a printf-style message through a Blockbuster::Log::Logger.
+ *
+ * The format string must be a string literal. It is registered once per call site, so the hot path only copies a
+ * format id, a timestamp and the raw arguments into the calling thread's ring.
+ *
+ * @param logger The logger to write to.
+ * @param ... The format string literal followed by its arguments.
+ * @return true if the message was queued, false if the thread's ring was full and the message was dropped.
+ */
+#define BLOCKBUSTER_LOG(logger, ...)                                                                                    \
+    [&](const char* blockbusterFormat, const auto&... blockbusterArgs) {                                               \
+        static const ::Blockbuster::Log::FormatId blockbusterFormatId {                                                \
+            ::Blockbuster::Log::registerFormat<::std::decay_t<decltype(blockbusterArgs)>...>(blockbusterFormat)       \
+        };                                                                                                             \
+        return (logger).log(blockbusterFormatId, blockbusterArgs...);                                                  \
+    }(__VA_ARGS__)
+
+namespace Blockbuster::Log {
+
+/**
+ * @brief Identifies a registered call site (format string plus argument types).
+ */
+using FormatId = std::uint32_t;
+
+namespace Detail {
+
+    // Strings are copied into the record; every other argument is copied as raw bytes.
+    template <typename T>
+    constexpr bool isString { std::is_convertible_v<const T&, std::string_view> };
+
+    template <typename T>
+    constexpr bool isRaw { std::is_arithmetic_v<T> || std::is_pointer_v<T> };
+
+    template <typename T>
+    auto encodedSize(const T& arg) -> std::size_t
+    {
+        if constexpr (isString<T>) {
+            return sizeof(std::uint32_t) + std::string_view { arg }.size() + 1;
+        } else {
+            static_assert(isRaw<T>, "Log arguments must be arithmetic, pointers or strings");
+            return sizeof(T);
+        }
+    }
+
+    template <typename T>
+    auto encode(std::byte* out, const T& arg) -> std::byte*
+    {
+        if constexpr (isString<T>) {
+            const std::string_view text { arg };
+            const auto length { static_cast<std::uint32_t>(text.size()) };
+            std::memcpy(out, &length, sizeof(length));
+            std::memcpy(out + sizeof(length), text.data(), text.size());
+            out[sizeof(length) + text.size()] = std::byte { 0 };
+            return out + sizeof(length) + text.size() + 1;
+        } else {
+            std::memcpy(out, &arg, sizeof(T));
+            return out + sizeof(T);
+        }
+    }
+
+    template <typename T>
+    using Decoded = std::conditional_t<isString<T>, const char*, T>;
+
+    template <typename T>
+    auto decode(const std::byte*& in) -> Decoded<T>
+    {
+        if constexpr (isString<T>) {
+            std::uint32_t length {};
+            std::memcpy(&length, in, sizeof(length));
+            const auto* text { reinterpret_cast<const char*>(in + sizeof(length)) }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            in += sizeof(length) + length + 1;
+            return text;
+        } else {
+            T value {};
+            std::memcpy(&value, in, sizeof(T));
+            in += sizeof(T);
+            return value;
+        }
+    }
+
+    // Appends a formatted message to out, decoding the arguments in the order they were encoded.
+    template <typename... Args>
+    void format(std::string& out, const char* fmt, [[maybe_unused]] const std::byte* in)
+    {
+        // Braced initialisation guarantees left-to-right evaluation of the decode calls.
+        const std::tuple<Decoded<Args>...> args { decode<Args>(in)... };
+        std::apply(
+            [&out, fmt](const auto&... values) {
+                std::array<char, 512> buffer {};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+                const int length { std::snprintf(buffer.data(), buffer.size(), fmt, values...) };
+                if (length < 0) {
+                    return;
+                }
+                if (static_cast<std::size_t>(length) < buffer.size()) {
+                    out.append(buffer.data(), static_cast<std::size_t>(length));
+                    return;
+                }
+                const std::size_t offset { out.size() };
+                out.resize(offset + static_cast<std::size_t>(length) + 1);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+                std::snprintf(&out[offset], static_cast<std::size_t>(length) + 1, fmt, values...);
+                out.pop_back();
+            },
+            args);
+    }
+
+    struct CallSite {
+        const char* format;
+        void (*formatter)(std::string&, const char*, const std::byte*);
+    };
+
+    // Call sites are registered once and never removed, so readers only need the published count.
+    class Registry {
+    public:
+        static constexpr std::size_t maxCallSites { 4096 };
+
+        static auto instance() -> Registry&
+        {
+            static Registry registry {};
+            return registry;
+        }
+
+        auto add(CallSite site) -> FormatId
+        {
+            const std::lock_guard<std::mutex> lock { m_mutex };
+            const std::size_t id { m_count.load(std::memory_order_relaxed) };
+            if (id == maxCallSites) {
+                return s_overflowId;
+            }
+            m_sites[id] = site;
+            m_count.store(id + 1, std::memory_order_release);
+            return static_cast<FormatId>(id);
+        }
+
+        [[nodiscard]] auto find(FormatId id) const -> const CallSite*
+        {
+            return id < m_count.load(std::memory_order_acquire) ? &m_sites[id] : nullptr;
+        }
+
+    private:
+        static constexpr FormatId s_overflowId { static_cast<FormatId>(maxCallSites) }; // NOLINT(readability-identifier-naming)
+
+        std::mutex m_mutex {};
+        std::array<CallSite, maxCallSites> m_sites {};
+        std::atomic<std::size_t> m_count { 0 };
+    };
+
+} // namespace Detail
+
+/**
+ * @brief Registers a call site's format string and argument types.
+ *
+ * This is normally invoked once per call site by BLOCKBUSTER_LOG.
+ *
+ * @tparam Args The decayed argument types.
+ * @param format The printf-style format string. Must have static storage duration.
+ * @return The format id to pass to Logger::log().
+ */
+template <typename... Args>
+auto registerFormat(const char* format) -> FormatId
+{
+    return Detail::Registry::instance().add({ format, &Detail::format<Args...> });
+}
+
+/**
+ * @brief A low-latency asynchronous logger.
+ *
+ * Each logging thread gets its own Spsc::ByteQueue into which log() copies only a format id, a timestamp and the raw
+ * arguments. A background thread drains every ring, does all formatting, and writes the output to a file in large
+ * batches. A message is dropped (and counted) rather than blocking when its thread's ring is full.
+ *
+ * @tparam BufferSize The size in bytes of each thread's ring. Must be a power of 2.
+ */
+template <std::size_t BufferSize = (1U << 16)>
+class Logger {
+public:
+    /**
+     * @brief Constructs a logger and starts its background thread.
+     *
+     * @param output The file to write to. Not owned, and must stay open for the lifetime of the logger.
+     * @param pollInterval How long the background thread sleeps when every ring is empty.
+     */
+    explicit Logger(std::FILE* output, std::chrono::microseconds pollInterval = std::chrono::microseconds { 100 })
+        : m_output { output }
+        , m_pollInterval { pollInterval }
+        , m_id { s_nextId.fetch_add(1, std::memory_order_relaxed) }
+        , m_worker { [this]() { run(); } }
+    {
+    }
+
+    /**
+     * @brief Stops the background thread after writing every queued message.
+     */
+    ~Logger()
+    {
+        m_running.store(false, std::memory_order_release);
+        m_worker.join();
+    }
+
+    // Delete copy and move constructors to avoid complications.
+    Logger(const Logger&) = delete;
+    auto operator=(const Logger&) -> Logger& = delete;
+    Logger(Logger&&) = delete;
+    auto operator=(Logger&&) -> Logger& = delete;
+
+    /**
+     * @brief Queues a message on the calling thread's ring.
+     *
+     * @tparam Args The argument types, which must match those the format id was registered with.
+     * @param id A format id from registerFormat().
+     * @param args The arguments to the format string.
+     * @return true if the message was queued, false if the ring was full and the message was dropped.
+     */
+    template <typename... Args>
+    auto log(FormatId id, const Args&... args) -> bool
+    {
+        const std::size_t size { s_prefixSize + (std::size_t { 0 } + ... + Detail::encodedSize(args)) };
+        auto& queue { threadBuffer().queue };
+
+        std::byte* out { queue.reserve(size) };
+        if (out == nullptr) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const auto timestamp { static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) };
+        std::memcpy(out, &id, sizeof(id));
+        std::memcpy(out + sizeof(id), &timestamp, sizeof(timestamp));
+        out += s_prefixSize;
+        ((out = Detail::encode(out, args)), ...);
+        queue.commit(size);
+        return true;
+    }
+
+    /**
+     * @brief Blocks until every message queued before the call has been written and the file flushed.
+     */
+    void flush()
+    {
+        const std::uint64_t request { m_flushRequested.fetch_add(1, std::memory_order_acq_rel) + 1 };
+        while (m_flushCompleted.load(std::memory_order_acquire) < request) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Returns the number of messages dropped because a ring was full.
+     *
+     * @return The number of dropped messages.
+     */
+    [[nodiscard]] auto droppedCount() const -> std::size_t
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t s_prefixSize { sizeof(FormatId) + sizeof(std::uint64_t) }; // NOLINT(readability-identifier-naming)
+    static constexpr std::size_t s_batchSize { 1U << 16 }; // NOLINT(readability-identifier-naming)
+
+    struct ThreadBuffer {
+        Spsc::ByteQueue<BufferSize> queue {};
+        std::atomic<bool> closed { false };
+    };
+
+    // Closes the thread's rings when it exits so the background thread can drain and discard them. Each Logger owns
+    // its rings, so the thread only keeps weak references and a destroyed Logger's rings are freed straight away.
+    struct ThreadBuffers {
+        std::vector<std::pair<std::uint64_t, std::weak_ptr<ThreadBuffer>>> buffers {};
+        std::uint64_t cachedId { 0 };
+        ThreadBuffer* cached { nullptr };
+
+        ~ThreadBuffers()
+        {
+            for (auto& entry : buffers) {
+                if (const std::shared_ptr<ThreadBuffer> buffer { entry.second.lock() }) {
+                    buffer->closed.store(true, std::memory_order_release);
+                }
+            }
+        }
+    };
+
+    // Logger ids are never reused, so a cached pointer left behind by a destroyed Logger is never returned.
+    auto threadBuffer() -> ThreadBuffer&
+    {
+        static thread_local ThreadBuffers local {};
+        if (local.cachedId == m_id) {
+            return *local.cached;
+        }
+
+        auto found { std::find_if(local.buffers.begin(), local.buffers.end(),
+            [this](const auto& entry) { return entry.first == m_id; }) };
+        if (found == local.buffers.end()) {
+            local.buffers.erase(std::remove_if(local.buffers.begin(), local.buffers.end(),
+                                    [](const auto& entry) { return entry.second.expired(); }),
+                local.buffers.end());
+
+            // Allocated separately from the control block, so the ring's memory does not wait for the weak references.
+            const std::shared_ptr<ThreadBuffer> buffer { new ThreadBuffer {} };
+            {
+                const std::lock_guard<std::mutex> lock { m_mutex };
+                m_registered.push_back(buffer);
+                m_registrations.fetch_add(1, std::memory_order_release);
+            }
+            local.cachedId = m_id;
+            local.cached = buffer.get();
+            local.buffers.emplace_back(m_id, buffer);
+            return *local.cached;
+        }
+
+        local.cachedId = m_id;
+        local.cached = found->second.lock().get();
+        return *local.cached;
+    }
+
+    void run()
+    {
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers {};
+        std::uint64_t seenRegistrations { 0 };
+        std::string batch {};
+        batch.reserve(s_batchSize * 2);
+
+        for (;;) {
+            const bool stopping { !m_running.load(std::memory_order_acquire) };
+            const std::uint64_t flushRequest { m_flushRequested.load(std::memory_order_acquire) };
+
+            if (m_registrations.load(std::memory_order_acquire) != seenRegistrations) {
+                const std::lock_guard<std::mutex> lock { m_mutex };
+                seenRegistrations = m_registrations.load(std::memory_order_relaxed);
+                buffers = m_registered;
+            }
+
+            std::size_t drained { 0 };
+            for (const auto& buffer : buffers) {
+                drained += drain(buffer->queue, batch);
+            }
+            removeClosed(buffers);
+
+            if (batch.size() >= s_batchSize || drained == 0) {
+                write(batch);
+            }
+            if (flushRequest != m_flushCompleted.load(std::memory_order_relaxed)) {
+                write(batch);
+                std::fflush(m_output);
+                m_flushCompleted.store(flushRequest, std::memory_order_release);
+            }
+            if (stopping) {
+                write(batch);
+                std::fflush(m_output);
+                return;
+            }
+            if (drained == 0) {
+                std::this_thread::sleep_for(m_pollInterval);
+            }
+        }
+    }
+
+    auto drain(Spsc::ByteQueue<BufferSize>& queue, std::string& batch) -> std::size_t
+    {
+        std::size_t count { 0 };
+        while (auto record { queue.read() }) {
+            FormatId id {};
+            std::uint64_t timestamp {};
+            std::memcpy(&id, record->data, sizeof(id));
+            std::memcpy(&timestamp, record->data + sizeof(id), sizeof(timestamp));
+
+            std::array<char, 32> prefix {};
+            const auto nanoseconds { timestamp - m_startTime };
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+            const int length { std::snprintf(prefix.data(), prefix.size(), "%llu.%09llu ",
+                static_cast<unsigned long long>(nanoseconds / 1000000000U), // NOLINT(google-runtime-int)
+                static_cast<unsigned long long>(nanoseconds % 1000000000U)) }; // NOLINT(google-runtime-int)
+            batch.append(prefix.data(), static_cast<std::size_t>(std::max(length, 0)));
+
+            if (const Detail::CallSite* site { Detail::Registry::instance().find(id) }) {
+                site->formatter(batch, site->format, record->data + s_prefixSize);
+            } else {
+                batch.append("<unregistered log call site>");
+            }
+            batch.push_back('\n');
+
+            queue.release();
+            ++count;
+        }
+        return count;
+    }
+
+    // Closed rings are only discarded once empty; the closing store happens after the thread's last commit.
+    void removeClosed(std::vector<std::shared_ptr<ThreadBuffer>>& buffers)
+    {
+        const auto isFinished { [](const std::shared_ptr<ThreadBuffer>& buffer) {
+            return buffer->closed.load(std::memory_order_acquire) && !buffer->queue.read().has_value();
+        } };
+        if (std::none_of(buffers.begin(), buffers.end(), isFinished)) {
+            return;
+        }
+
+        const std::lock_guard<std::mutex> lock { m_mutex };
+        m_registered.erase(std::remove_if(m_registered.begin(), m_registered.end(), isFinished), m_registered.end());
+        buffers = m_registered;
+    }
+
+    void write(std::string& batch)
+    {
+        if (!batch.empty()) {
+            std::fwrite(batch.data(), 1, batch.size(), m_output);
+            batch.clear();
+        }
+    }
+
+    inline static std::atomic<std::uint64_t> s_nextId { 1 }; // NOLINT(readability-identifier-naming)
+
+    std::FILE* m_output;
+    std::chrono::microseconds m_pollInterval;
+    std::uint64_t m_id;
+    std::uint64_t m_startTime { static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) };
+
+    std::mutex m_mutex {};
+    std::vector<std::shared_ptr<ThreadBuffer>> m_registered {};
+    std::atomic<std::uint64_t> m_registrations { 0 };
+
+    std::atomic<bool> m_running { true };
+    std::atomic<std::uint64_t> m_flushRequested { 0 };
+    std::atomic<std::uint64_t> m_flushCompleted { 0 };
+    std::atomic<std::size_t> m_dropped { 0 };
+
+    // Declared last so that everything the background thread touches is initialised before it starts.
+    std::thread m_worker;
+};
+
+} // namespace Blockbuster::Log
@@ -0,0 +1,333 @@
+#pragma once
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "Mpmc::Channel requires C++20 coroutines"
+#endif
+#include "../common.hpp"
+#include "../fence.hpp"
+#include "queue.hpp"
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace Blockbuster::Mpmc {
+
+/**
+ * @brief Resumes a coroutine immediately on the thread that made it runnable.
+ */
+struct InlineExecutor {
+    void operator()(std::coroutine_handle<> handle) const
+    {
+        handle.resume();
+    }
+};
+
+/**
+ * @brief An asynchronous Multi-Producer Multi-Consumer (MPMC) channel for coroutines, built on Queue.
+ *
+ * co_await send(item) and co_await receive() complete synchronously while the ring has space or data. Otherwise the
+ * coroutine is pushed onto a lock-free waiter list and suspends. Whoever next frees space or publishes an item takes
+ * the whole list, completes as many waiters as it can by enqueuing or dequeuing on their behalf, returns the rest, and
+ * hands the completed coroutines to the executor. No thread ever blocks.
+ *
+ * On the fast path, each completed operation adds a light fence and a relaxed load of the opposite waiter list. The
+ * matching heavy fences are paid when a coroutine suspends or waiters are returned to a list.
+ *
+ * @tparam T The type of elements sent through the channel.
+ * @tparam Capacity The capacity of the underlying ring. Must be a power of 2.
+ * @tparam Executor A callable that resumes a std::coroutine_handle<>, e.g. by posting it to an event loop. The default
+ * resumes it inline, inside the send() or receive() that completed it.
+ * @note Waiters are completed roughly in the order they suspended, but this is not guaranteed under contention.
+ */
+template <typename T, std::size_t Capacity, typename Executor = InlineExecutor>
+class Channel {
+    struct Waiter {
+        Waiter* next { nullptr };
+        std::coroutine_handle<> handle {};
+        // Set by both the suspending coroutine and the thread that completes it; the second one to arrive resumes it.
+        std::atomic<bool> handoff { false };
+    };
+
+public:
+    /**
+     * @brief The awaitable returned by send().
+     */
+    class SendAwaiter : private Waiter {
+    public:
+        auto await_ready() -> bool
+        {
+            return m_channel->trySend(std::move(m_item));
+        }
+
+        auto await_suspend(std::coroutine_handle<> coroutine) -> bool
+        {
+            return m_channel->suspend(m_channel->m_senders, *this, coroutine);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        friend class Channel;
+
+        template <typename U>
+        SendAwaiter(Channel& channel, U&& item)
+            : m_channel { &channel }
+            , m_item { std::forward<U>(item) }
+        {
+        }
+
+        Channel* m_channel;
+        T m_item;
+    };
+
+    /**
+     * @brief The awaitable returned by receive().
+     */
+    class ReceiveAwaiter : private Waiter {
+    public:
+        auto await_ready() -> bool
+        {
+            m_item = m_channel->tryReceive();
+            return m_item.has_value();
+        }
+
+        auto await_suspend(std::coroutine_handle<> coroutine) -> bool
+        {
+            return m_channel->suspend(m_channel->m_receivers, *this, coroutine);
+        }
+
+        auto await_resume() -> T
+        {
+            return std::move(*m_item);
+        }
+
+    private:
+        friend class Channel;
+
+        explicit ReceiveAwaiter(Channel& channel)
+            : m_channel { &channel }
+        {
+        }
+
+        Channel* m_channel;
+        std::optional<T> m_item {};
+    };
+
+    /**
+     * @brief Constructs a channel.
+     *
+     * @param executor The executor that resumes suspended coroutines once their operation completes.
+     */
+    explicit Channel(Executor executor = {})
+        : m_executor { std::move(executor) }
+    {
+    }
+
+    ~Channel() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Channel(const Channel&) = delete;
+    auto operator=(const Channel&) -> Channel& = delete;
+    Channel(Channel&&) = delete;
+    auto operator=(Channel&&) -> Channel& = delete;
+
+    /**
+     * @brief Sends an item, suspending while the channel is full.
+     *
+     * @tparam U Type of the item to send (allows for perfect forwarding).
+     * @param item The item to send.
+     * @return An awaitable that completes once the item is in the channel.
+     * @note The channel must outlive every pending operation.
+     */
+    template <typename U>
+    [[nodiscard]] auto send(U&& item) -> SendAwaiter
+    {
+        return SendAwaiter { *this, std::forward<U>(item) };
+    }
+
+    /**
+     * @brief Receives an item, suspending while the channel is empty.
+     *
+     * @return An awaitable that completes with the received item.
+     * @note The channel must outlive every pending operation.
+     */
+    [[nodiscard]] auto receive() -> ReceiveAwaiter
+    {
+        return ReceiveAwaiter { *this };
+    }
+
+    /**
+     * @brief Sends an item without suspending, e.g. from a thread that is not a coroutine.
+     *
+     * @tparam U Type of the item to send (allows for perfect forwarding).
+     * @param item The item to send.
+     * @return true if the item was sent, false if the channel was full.
+     */
+    template <typename U>
+    auto trySend(U&& item) -> bool
+    {
+        if (!m_queue.enqueue(std::forward<U>(item))) {
+            return false;
+        }
+        // Order the enqueue before the waiter check (pairs with the heavy fences in suspend() and drain()).
+        Blockbuster::lightFence();
+        if (m_receivers.load(std::memory_order_relaxed) != nullptr) {
+            pump();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Receives an item without suspending, e.g. from a thread that is not a coroutine.
+     *
+     * @return An optional containing the received item, or std::nullopt if the channel was empty.
+     */
+    auto tryReceive() -> std::optional<T>
+    {
+        std::optional<T> item { m_queue.dequeue() };
+        if (!item) {
+            return std::nullopt;
+        }
+        Blockbuster::lightFence();
+        if (m_senders.load(std::memory_order_relaxed) != nullptr) {
+            pump();
+        }
+        return item;
+    }
+
+    /**
+     * @brief Checks if the channel is empty.
+     *
+     * @return true if the channel is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return m_queue.empty();
+    }
+
+    /**
+     * @brief Returns the current number of items in the channel.
+     *
+     * @return The number of buffered items, excluding those held by suspended senders.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_queue.size();
+    }
+
+    /**
+     * @brief Returns the capacity of the channel.
+     *
+     * @return The maximum number of buffered items.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return Capacity;
+    }
+
+private:
+    // Publishes the waiter and retries its operation once on its behalf. Returns false if it already completed, in
+    // which case the coroutine carries on without suspending.
+    auto suspend(std::atomic<Waiter*>& list, Waiter& waiter, std::coroutine_handle<> coroutine) -> bool
+    {
+        waiter.handle = coroutine;
+        push(list, &waiter, &waiter);
+        // Order the push before the retry (pairs with the light fences in trySend() and tryReceive()).
+        Blockbuster::heavyFence();
+        pump();
+        // After this exchange the coroutine may be resumed at any time, so the waiter must not be touched again.
+        return !waiter.handoff.exchange(true, std::memory_order_acq_rel);
+    }
+
+    // Completes waiters until neither list can make progress. Completing a sender publishes an item and completing
+    // a receiver frees a slot, so each list is retried whenever the other one moved.
+    void pump()
+    {
+        Waiter* completed { nullptr };
+        for (bool progress { true }; progress;) {
+            progress = drain(m_receivers, completed, [this](Waiter* waiter) {
+                auto* const receiver { static_cast<ReceiveAwaiter*>(waiter) };
+                receiver->m_item = m_queue.dequeue();
+                return receiver->m_item.has_value();
+            }, [this]() { return !m_queue.empty(); });
+            progress = drain(m_senders, completed, [this](Waiter* waiter) {
+                return m_queue.enqueue(std::move(static_cast<SendAwaiter*>(waiter)->m_item));
+            }, [this]() { return !m_queue.full(); }) || progress;
+        }
+
+        // Resume only after every unfinished waiter is back on its list, so a long-running coroutine cannot hide them.
+        while (completed != nullptr) {
+            Waiter* const next { completed->next };
+            const std::coroutine_handle<> coroutine { completed->handle };
+            if (completed->handoff.exchange(true, std::memory_order_acq_rel)) {
+                m_executor(coroutine);
+            }
+            completed = next;
+        }
+    }
+
+    // Takes the whole list, which avoids the ABA problem of popping single nodes, and completes waiters oldest first
+    // until one fails. The rest go back on the list, after which a slot or item freed in the meantime may have missed
+    // them, so the list is taken again while the operation looks possible.
+    template <typename Attempt, typename Possible>
+    auto drain(std::atomic<Waiter*>& list, Waiter*& completed, Attempt attempt, Possible possible) -> bool
+    {
+        bool progress { false };
+        while (list.load(std::memory_order_relaxed) != nullptr) {
+            Waiter* waiter { reverse(list.exchange(nullptr, std::memory_order_acquire)) };
+            while (waiter != nullptr && attempt(waiter)) {
+                Waiter* const next { waiter->next };
+                waiter->next = completed;
+                completed = waiter;
+                waiter = next;
+                progress = true;
+            }
+            if (waiter == nullptr) {
+                break;
+            }
+
+            // Reversing back makes the oldest remaining waiter the last of the chain.
+            push(list, reverse(waiter), waiter);
+            Blockbuster::heavyFence();
+            if (!possible()) {
+                break;
+            }
+        }
+        return progress;
+    }
+
+    // Pushes a chain of waiters from first to last.
+    static void push(std::atomic<Waiter*>& list, Waiter* first, Waiter* last)
+    {
+        Waiter* head { list.load(std::memory_order_relaxed) };
+        do {
+            last->next = head;
+        } while (!list.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    static auto reverse(Waiter* waiter) -> Waiter*
+    {
+        Waiter* reversed { nullptr };
+        while (waiter != nullptr) {
+            Waiter* const next { waiter->next };
+            waiter->next = reversed;
+            reversed = waiter;
+            waiter = next;
+        }
+        return reversed;
+    }
+
+    Queue<T, Capacity> m_queue {};
+    Executor m_executor;
+
+    // Pad as necessary to avoid false sharing.
+    alignas(Blockbuster::cacheLineSize) std::atomic<Waiter*> m_senders { nullptr };
+    alignas(Blockbuster::cacheLineSize) std::atomic<Waiter*> m_receivers { nullptr };
+};
+
+} // namespace Blockbuster::Mpmc
@@ -0,0 +1,167 @@
+#pragma once
+#include "../object_pool.hpp"
+#include "queue.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace Blockbuster::Mpmc {
+
+/**
+ * @brief A lock-free Multi-Producer Multi-Consumer (MPMC) queue for large payloads.
+ *
+ * Unlike Queue, which stores each element inline in its ring, this queue keeps payloads in a preallocated slab and
+ * only passes 32-bit handles through the ring. The ring stays small enough to remain cache-resident and the sequence
+ * protocol never copies a payload: producers claim a slot, write it in place and publish its handle, and consumers
+ * read the payload in place before releasing the slot.
+ *
+ * @tparam T The type of elements stored in the queue. Must be default constructible.
+ * @tparam Capacity The maximum number of elements the queue can hold. Must be a power of 2.
+ */
+template <typename T, std::size_t Capacity>
+class HandleQueue {
+public:
+    /**
+     * @brief A compact reference to a payload slot.
+     */
+    using Handle = std::uint32_t;
+
+    HandleQueue() = default;
+    ~HandleQueue() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    HandleQueue(const HandleQueue&) = delete;
+    auto operator=(const HandleQueue&) -> HandleQueue& = delete;
+    HandleQueue(HandleQueue&&) = delete;
+    auto operator=(HandleQueue&&) -> HandleQueue& = delete;
+
+    /**
+     * @brief Claims a free payload slot for the caller to fill in place.
+     *
+     * @return The handle of the claimed slot, or std::nullopt if every slot is queued or in use.
+     */
+    auto claim() -> std::optional<Handle>
+    {
+        return m_slab.acquireHandle();
+    }
+
+    /**
+     * @brief Publishes a claimed slot to consumers.
+     *
+     * @param handle A handle obtained from claim() whose payload has been written.
+     * @note The ring has room for every slot in the slab, but its next cell can still be held by a consumer that has
+     * claimed it and not yet released it. This spins until that consumer finishes rather than dropping the handle.
+     */
+    void publish(Handle handle)
+    {
+        while (!m_ring.enqueue(handle)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Takes the oldest published slot for the caller to read in place.
+     *
+     * @return The handle of the slot, or std::nullopt if the queue was empty.
+     */
+    auto consume() -> std::optional<Handle>
+    {
+        return m_ring.dequeue();
+    }
+
+    /**
+     * @brief Returns a consumed slot to the slab.
+     *
+     * @param handle A handle obtained from consume() that is no longer being read.
+     */
+    void release(Handle handle)
+    {
+        m_slab.release(handle);
+    }
+
+    /**
+     * @brief Resolves a handle to its payload.
+     *
+     * @param handle A handle obtained from claim() or consume().
+     * @return A reference to the payload.
+     */
+    [[nodiscard]] auto get(Handle handle) -> T&
+    {
+        return m_slab.get(handle);
+    }
+
+    /**
+     * @brief Enqueues an item by copying it into a claimed slot.
+     *
+     * @tparam U Type of the item to enqueue (allows for perfect forwarding).
+     * @param item The item to enqueue.
+     * @return true if the item was successfully enqueued, false if the queue was full.
+     */
+    template <typename U>
+    auto enqueue(U&& item) -> bool
+    {
+        const std::optional<Handle> handle { claim() };
+        if (!handle) {
+            return false;
+        }
+        get(*handle) = std::forward<U>(item);
+        publish(*handle);
+        return true;
+    }
+
+    /**
+     * @brief Dequeues an item by moving it out of its slot.
+     *
+     * @return An optional containing the dequeued item if successful, or std::nullopt if the queue was empty.
+     */
+    auto dequeue() -> std::optional<T>
+    {
+        const std::optional<Handle> handle { consume() };
+        if (!handle) {
+            return std::nullopt;
+        }
+        std::optional<T> result { std::move(get(*handle)) };
+        release(*handle);
+        return result;
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return m_ring.empty();
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of elements the queue can hold.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return Capacity;
+    }
+
+    /**
+     * @brief Returns the current number of published elements in the queue.
+     *
+     * @return The current number of elements in the queue.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_ring.size();
+    }
+
+private:
+    Queue<Handle, Capacity> m_ring {};
+    ObjectPool<T, Capacity> m_slab {};
+};
+
+} // namespace Blockbuster::Mpmc
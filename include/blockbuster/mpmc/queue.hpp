@@ -1,4 +1,6 @@
 #pragma once
+#include "../stats_policy.hpp"
+#include "../trace/trace_point.hpp"
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -15,9 +17,11 @@ constexpr std::size_t cacheLineSize { 64 };
  *
  * @tparam T The type of elements stored in the queue.
  * @tparam Capacity The maximum number of elements the queue can hold. Must be a power of 2.
+ * @tparam Stats The statistics policy. NoStats (the default) compiles away; QueueStats counts operation outcomes, and
+ * LatencyStats also measures how long elements spend in the queue. Both are declared in stats.hpp.
  */
-template <typename T, std::size_t Capacity>
-class Queue {
+template <typename T, std::size_t Capacity, typename Stats = NoStats>
+class Queue : private Stats {
 public:
     Queue()
     {
@@ -55,7 +59,10 @@ public:
                 if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
                     break;
                 }
+                Stats::onCasRetry();
             } else if (dif < 0) {
+                Stats::onEnqueueFull();
+                BLOCKBUSTER_TRACE(enqueueFull, this, pos);
                 return false;
             } else {
                 pos = m_enqueuePos.load(std::memory_order_relaxed);
@@ -63,7 +70,14 @@ public:
         }
 
         cell->data = std::forward<U>(item);
+        Stats::onWrite(wrap(pos));
         cell->sequence.store(pos + 1, std::memory_order_release);
+        if constexpr (Stats::enabled) {
+            // Consumers may already have moved past this item, so the depth must not wrap below zero.
+            const auto depth { static_cast<std::ptrdiff_t>(pos + 1 - m_dequeuePos.load(std::memory_order_relaxed)) };
+            Stats::onEnqueue(depth > 0 ? static_cast<std::size_t>(depth) : 0);
+        }
+        BLOCKBUSTER_TRACE(enqueue, this, pos);
         return true;
     }
 
@@ -86,7 +100,10 @@ public:
                 if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
                     break;
                 }
+                Stats::onCasRetry();
             } else if (dif < 0) {
+                Stats::onDequeueEmpty();
+                BLOCKBUSTER_TRACE(dequeueEmpty, this, pos);
                 return std::nullopt;
             } else {
                 pos = m_dequeuePos.load(std::memory_order_relaxed);
@@ -94,7 +111,10 @@ public:
         }
 
         const T result { std::move(cell->data) };
+        Stats::onRead(wrap(pos));
         cell->sequence.store(pos + s_capacity, std::memory_order_release);
+        Stats::onDequeue();
+        BLOCKBUSTER_TRACE(dequeue, this, pos);
         return result;
     }
 
@@ -141,6 +161,16 @@ public:
         return m_enqueuePos.load(std::memory_order_relaxed) - m_dequeuePos.load(std::memory_order_relaxed);
     }
 
+    /**
+     * @brief Returns the statistics recorded by the Stats policy.
+     *
+     * @return The statistics policy, e.g. to call snapshot() on.
+     */
+    [[nodiscard]] auto stats() const -> const Stats&
+    {
+        return *this;
+    }
+
 private:
     struct Cell {
         std::atomic<size_t> sequence {};
@@ -149,6 +179,7 @@ private:
 
     static constexpr std::size_t s_capacity { Capacity }; // NOLINT(readability-identifier-naming)
     static_assert(s_capacity > 0 && (s_capacity & (s_capacity - 1)) == 0, "Capacity must be greater than 0 and a power of 2");
+    static_assert(Stats::bufferCapacity == 0 || Stats::bufferCapacity == s_capacity, "Stats must be sized for the queue's Capacity");
 
     // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
     [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
@@ -0,0 +1,359 @@
+#pragma once
+#include "../common.hpp"
+#include "../shared_memory.hpp"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <signal.h>
+#include <type_traits>
+#include <utility>
+
+namespace Blockbuster::Mpmc {
+
+/**
+ * @brief A lock-free Multi-Producer Multi-Consumer (MPMC) queue shared between processes.
+ *
+ * The queue uses the same per-cell sequence protocol as Queue, placed in a POSIX shared memory object with a
+ * versioned, pointer-free layout (see Spsc::SharedQueue for the create/attach semantics). To survive a process
+ * crashing mid-operation, each cell also records the pid of the process currently writing or reading it. The owner is
+ * stamped before the position is claimed and cleared after the cell is handed on, so a cell left behind by a crashed
+ * process always names its owner. recover() finds such cells and repairs them: a half-written element is published as
+ * abandoned, which consumers skip, and a half-read element is released back to producers.
+ *
+ * @tparam T The type of elements stored in the queue. Must be trivially copyable.
+ * @tparam Capacity The maximum number of elements the queue can hold. Must be a power of 2 and at least 2.
+ * @note The owner stamp costs one extra compare-and-swap per operation compared to Queue.
+ */
+template <typename T, std::size_t Capacity>
+class SharedQueue {
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        std::atomic<pid_t> owner;
+        std::atomic<bool> abandoned;
+        T data;
+    };
+
+    struct Layout {
+        SharedHeader header;
+        std::atomic<std::size_t> abandonedCount;
+
+        // Pad as necessary to avoid false sharing.
+        alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> enqueuePos;
+        alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> dequeuePos;
+        alignas(Blockbuster::cacheLineSize) std::array<Cell, Capacity> buffer;
+    };
+
+public:
+    /**
+     * @brief Creates a named shared queue.
+     *
+     * @param name The shared memory object name (e.g. "/jobs"). Creation fails if it already exists.
+     * @return The queue, or std::nullopt if the object could not be created or mapped.
+     */
+    static auto create(const char* name) -> std::optional<SharedQueue>
+    {
+        return initialize(SharedMemory::create(name, sizeof(Layout)));
+    }
+
+    /**
+     * @brief Creates an anonymous shared queue whose file descriptor can be inherited or passed to another process.
+     *
+     * @return The queue, or std::nullopt if the memory could not be created or mapped.
+     */
+    static auto createAnonymous() -> std::optional<SharedQueue>
+    {
+        return initialize(SharedMemory::createAnonymous(sizeof(Layout)));
+    }
+
+    /**
+     * @brief Attaches to a named shared queue created by another process.
+     *
+     * @param name The shared memory object name passed to create().
+     * @return The queue, or std::nullopt if the object does not exist, is not ready yet, or has an incompatible layout.
+     */
+    static auto attach(const char* name) -> std::optional<SharedQueue>
+    {
+        return validate(SharedMemory::open(name, sizeof(Layout)));
+    }
+
+    /**
+     * @brief Attaches to a shared queue through a file descriptor.
+     *
+     * @param fd A file descriptor referring to the queue's memory. The queue takes ownership of it.
+     * @return The queue, or std::nullopt if it is not ready yet or has an incompatible layout.
+     */
+    static auto attach(int fd) -> std::optional<SharedQueue>
+    {
+        return validate(SharedMemory::open(fd, sizeof(Layout)));
+    }
+
+    /**
+     * @brief Removes a named shared queue; existing mappings stay valid until they are closed.
+     *
+     * @param name The shared memory object name passed to create().
+     * @return true if the name was removed, false otherwise.
+     */
+    static auto unlink(const char* name) -> bool
+    {
+        return SharedMemory::unlink(name);
+    }
+
+    ~SharedQueue() = default;
+
+    SharedQueue(const SharedQueue&) = delete;
+    auto operator=(const SharedQueue&) -> SharedQueue& = delete;
+    SharedQueue(SharedQueue&&) noexcept = default;
+    auto operator=(SharedQueue&&) -> SharedQueue& = delete;
+
+    /**
+     * @brief Enqueues an item.
+     *
+     * @param item The item to enqueue.
+     * @return true if the item was successfully enqueued, false if the queue was full or the next cell is still held
+     * by another process (e.g. one that crashed and has not been recovered yet).
+     */
+    auto enqueue(const T& item) -> bool
+    {
+        const std::optional<std::size_t> pos { claim(m_layout->enqueuePos, 0) };
+        if (!pos) {
+            return false;
+        }
+
+        Cell& cell { m_layout->buffer[wrap(*pos)] };
+        cell.data = item;
+        cell.sequence.store(*pos + 1, std::memory_order_release);
+        cell.owner.store(0, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeues an item, skipping any elements abandoned by crashed producers.
+     *
+     * @return An optional containing the dequeued item if successful, or std::nullopt if the queue was empty or the
+     * next cell is still held by another process.
+     */
+    auto dequeue() -> std::optional<T>
+    {
+        for (;;) {
+            const std::optional<std::size_t> pos { claim(m_layout->dequeuePos, 1) };
+            if (!pos) {
+                return std::nullopt;
+            }
+
+            Cell& cell { m_layout->buffer[wrap(*pos)] };
+            const bool abandoned { cell.abandoned.load(std::memory_order_relaxed) };
+            const T item { cell.data };
+            cell.abandoned.store(false, std::memory_order_relaxed);
+            cell.sequence.store(*pos + s_capacity, std::memory_order_release);
+            cell.owner.store(0, std::memory_order_release);
+            if (!abandoned) {
+                return item;
+            }
+        }
+    }
+
+    /**
+     * @brief Repairs cells left mid-operation by a specific crashed process.
+     *
+     * @param crashed The pid of a process known to have exited, e.g. from waitpid() in a supervisor.
+     * @return The number of cells repaired.
+     * @note Must only be called once the process has exited, as its cells are taken over unconditionally.
+     */
+    auto recover(pid_t crashed) -> std::size_t
+    {
+        return recoverIf([crashed](pid_t owner) { return owner == crashed; });
+    }
+
+    /**
+     * @brief Repairs cells left mid-operation by any process that no longer exists.
+     *
+     * @return The number of cells repaired.
+     * @note A crashed child that has not been reaped yet still exists, and a recycled pid hides a crash until the new
+     * process exits. Prefer recover(pid_t) when the crashed process is known.
+     */
+    auto recover() -> std::size_t
+    {
+        return recoverIf([](pid_t owner) { return ::kill(owner, 0) != 0 && errno == ESRCH; });
+    }
+
+    /**
+     * @brief Returns the number of elements lost to crashed producers.
+     *
+     * @return The number of cells published as abandoned by recover().
+     */
+    [[nodiscard]] auto abandonedCount() const -> std::size_t
+    {
+        return m_layout->abandonedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the current number of elements in the queue, including any abandoned elements not yet skipped.
+     *
+     * @return The current number of elements in the queue.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_layout->enqueuePos.load(std::memory_order_relaxed) - m_layout->dequeuePos.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of elements the queue can hold.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return s_capacity;
+    }
+
+    /**
+     * @brief Returns the file descriptor backing the queue, e.g. to pass an anonymous queue to another process.
+     *
+     * @return The file descriptor.
+     */
+    [[nodiscard]] auto fd() const -> int
+    {
+        return m_memory.fd();
+    }
+
+private:
+    static constexpr std::size_t s_capacity { Capacity }; // NOLINT(readability-identifier-naming)
+    static_assert(s_capacity >= 2 && (s_capacity & (s_capacity - 1)) == 0, "Capacity must be at least 2 and a power of 2");
+    static_assert(std::is_trivially_copyable_v<T>, "Elements shared between processes must be trivially copyable");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free && std::atomic<pid_t>::is_always_lock_free,
+        "Shared atomics must be lock-free");
+
+    static constexpr std::uint64_t s_magic { 0x424C4B4D504D4351 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint32_t s_version { 1 }; // NOLINT(readability-identifier-naming)
+
+    // How many times an operation retries the same cell held by another process before reporting failure.
+    static constexpr std::size_t s_heldRetries { 1024 }; // NOLINT(readability-identifier-naming)
+
+    explicit SharedQueue(SharedMemory memory)
+        : m_memory { std::move(memory) }
+        , m_layout { static_cast<Layout*>(m_memory.data()) }
+    {
+    }
+
+    // The memory is freshly zero-filled, so only the cell sequences need initialising before the header is published.
+    static auto initialize(std::optional<SharedMemory> memory) -> std::optional<SharedQueue>
+    {
+        if (!memory) {
+            return std::nullopt;
+        }
+        auto* layout { new (memory->data()) Layout };
+        for (std::size_t i { 0 }; i < s_capacity; ++i) {
+            layout->buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        layout->header.publish(s_magic, s_version, sizeof(T), s_capacity);
+        return SharedQueue { std::move(*memory) };
+    }
+
+    static auto validate(std::optional<SharedMemory> memory) -> std::optional<SharedQueue>
+    {
+        if (!memory || !static_cast<const Layout*>(memory->data())->header.matches(s_magic, s_version, sizeof(T), s_capacity)) {
+            return std::nullopt;
+        }
+        return SharedQueue { std::move(*memory) };
+    }
+
+    // Claims the next position of a cursor, stamping the cell's owner before the cursor is advanced. The cell is ready
+    // for this side when its sequence equals the position plus the offset (0 for producers, 1 for consumers).
+    auto claim(std::atomic<std::size_t>& cursor, std::size_t offset) -> std::optional<std::size_t>
+    {
+        std::size_t pos { cursor.load(std::memory_order_relaxed) };
+        std::size_t held { 0 };
+        std::size_t heldPos { pos };
+
+        for (;;) {
+            Cell& cell { m_layout->buffer[wrap(pos)] };
+            const std::size_t seq { cell.sequence.load(std::memory_order_acquire) };
+            const auto dif { static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + offset) };
+
+            if (dif == 0) {
+                pid_t expected { 0 };
+                if (cell.owner.compare_exchange_strong(expected, Detail::currentPid(), std::memory_order_acquire)) {
+                    if (cursor.compare_exchange_strong(pos, pos + 1, std::memory_order_relaxed)) {
+                        return pos;
+                    }
+                    cell.owner.store(0, std::memory_order_release);
+                } else {
+                    // A holder in this process is a live thread about to finish; only another process can have died.
+                    if (expected != Detail::currentPid()) {
+                        held = pos == heldPos ? held + 1 : 1;
+                        heldPos = pos;
+                        if (held == s_heldRetries) {
+                            return std::nullopt;
+                        }
+                    }
+                    pos = cursor.load(std::memory_order_relaxed);
+                }
+            } else if (dif < 0) {
+                return std::nullopt;
+            } else {
+                pos = cursor.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // A crashed owner's cell is either claimed for writing (sequence == position < enqueuePos), claimed for reading
+    // (sequence == position + 1, position < dequeuePos) or unclaimed, in which case only the stamp needs clearing.
+    // Positions cannot move past a cell whose owner is dead, so the cursors read here are stable for that cell.
+    template <typename IsDead>
+    auto recoverIf(IsDead isDead) -> std::size_t
+    {
+        std::size_t repaired { 0 };
+        for (std::size_t i { 0 }; i < s_capacity; ++i) {
+            Cell& cell { m_layout->buffer[i] };
+            pid_t owner { cell.owner.load(std::memory_order_acquire) };
+            if (owner == 0 || owner == Detail::currentPid() || !isDead(owner)) {
+                continue;
+            }
+            // Take the cell over so that concurrent recoveries cannot repair it twice.
+            if (!cell.owner.compare_exchange_strong(owner, Detail::currentPid(), std::memory_order_acquire)) {
+                continue;
+            }
+
+            const std::size_t seq { cell.sequence.load(std::memory_order_acquire) };
+            if (wrap(seq) == i && seq < m_layout->enqueuePos.load(std::memory_order_acquire)) {
+                cell.abandoned.store(true, std::memory_order_relaxed);
+                cell.sequence.store(seq + 1, std::memory_order_release);
+                m_layout->abandonedCount.fetch_add(1, std::memory_order_relaxed);
+                ++repaired;
+            } else if (wrap(seq) != i && seq - 1 < m_layout->dequeuePos.load(std::memory_order_acquire)) {
+                cell.abandoned.store(false, std::memory_order_relaxed);
+                cell.sequence.store(seq - 1 + s_capacity, std::memory_order_release);
+                ++repaired;
+            }
+            cell.owner.store(0, std::memory_order_release);
+        }
+        return repaired;
+    }
+
+    // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
+    [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
+    {
+        return index & (s_capacity - 1);
+    }
+
+    SharedMemory m_memory;
+    Layout* m_layout;
+};
+
+} // namespace Blockbuster::Mpmc
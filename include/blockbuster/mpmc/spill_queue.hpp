@@ -0,0 +1,234 @@
+#pragma once
+#include "../common.hpp"
+#include "../shared_memory.hpp"
+#include "queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Blockbuster::Mpmc {
+
+/**
+ * @brief A Multi-Producer Multi-Consumer (MPMC) queue that spills to disk instead of failing when it fills up.
+ *
+ * Items normally go through an in-memory Queue. Once the ring reaches its high-water mark, further items are appended
+ * to a memory-mapped spill file, and consumers stream them back into the ring as it drains. While anything is spilled,
+ * every producer appends to the spill file, so each producer's items are still dequeued in the order it enqueued them.
+ * The fast path only adds a cursor check and an occupancy check. The spill path is lock-free: producers claim slots in
+ * the file with a CAS and publish each one with a sequence number, so they never wait for consumers or each other.
+ * Consumers take turns refilling the ring under a mutex that producers never touch.
+ *
+ * @tparam T The type of elements stored in the queue. Must be trivially copyable.
+ * @tparam Capacity The capacity of the in-memory ring. Must be a power of 2.
+ * @tparam SpillCapacity The capacity of the spill file in elements. Must be a power of 2.
+ * @note The spill file is created on first use and is removed automatically when the queue is destroyed.
+ */
+template <typename T, std::size_t Capacity, std::size_t SpillCapacity = (1U << 20)>
+class SpillQueue {
+public:
+    /**
+     * @brief Constructs a spill queue.
+     *
+     * @param directory The directory to create the spill file in.
+     * @param highWaterMark The ring occupancy at which items start to spill, clamped to [1, Capacity]. Defaults to three
+     * quarters of Capacity.
+     */
+    explicit SpillQueue(std::string directory, std::size_t highWaterMark = Capacity - Capacity / 4)
+        : m_directory { std::move(directory) }
+        , m_highWaterMark { std::clamp<std::size_t>(highWaterMark, 1, Capacity) }
+    {
+    }
+
+    ~SpillQueue()
+    {
+        delete m_file.load(std::memory_order_relaxed);
+    }
+
+    // Delete copy and move constructors to avoid complications.
+    SpillQueue(const SpillQueue&) = delete;
+    auto operator=(const SpillQueue&) -> SpillQueue& = delete;
+    SpillQueue(SpillQueue&&) = delete;
+    auto operator=(SpillQueue&&) -> SpillQueue& = delete;
+
+    /**
+     * @brief Enqueues an item, spilling it to disk if the ring is above its high-water mark.
+     *
+     * @param item The item to enqueue.
+     * @return true if the item was successfully enqueued, false if both the ring and the spill file were full (or
+     * the spill file could not be created).
+     */
+    auto enqueue(const T& item) -> bool
+    {
+        if (!spilling() && m_ring.size() < m_highWaterMark && m_ring.enqueue(item)) {
+            return true;
+        }
+        return spill(item);
+    }
+
+    /**
+     * @brief Dequeues an item, first moving spilled items back into the ring if it has drained.
+     *
+     * @return An optional containing the dequeued item if successful, or std::nullopt if the queue was empty.
+     */
+    auto dequeue() -> std::optional<T>
+    {
+        if (spilling()) {
+            std::unique_lock<std::mutex> lock { m_mutex, std::try_to_lock };
+            // Only wait for another consumer's refill when there is nothing else to take.
+            if (!lock.owns_lock() && m_ring.empty()) {
+                lock.lock();
+            }
+            if (lock.owns_lock()) {
+                refill();
+            }
+        }
+        return m_ring.dequeue();
+    }
+
+    /**
+     * @brief Returns the number of items currently in the spill file.
+     *
+     * @return The number of spilled items.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto spilledCount() const -> std::size_t
+    {
+        const std::size_t head { m_spillHead.load(std::memory_order_relaxed) };
+        const std::size_t tail { m_spillTail.load(std::memory_order_relaxed) };
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the current number of elements in the ring and the spill file.
+     *
+     * @return The current number of elements in the queue.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_ring.size() + spilledCount();
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of elements the ring and spill file can hold together.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return Capacity + SpillCapacity;
+    }
+
+private:
+    static_assert(std::is_trivially_copyable_v<T>, "Spilled elements must be trivially copyable");
+    static_assert(SpillCapacity > 0 && (SpillCapacity & (SpillCapacity - 1)) == 0, "SpillCapacity must be greater than 0 and a power of 2");
+
+    // Each spilled item is published through its own sequence. The file starts zero-filled, so the slot holds the item
+    // for position pos once its sequence is pos + 1.
+    struct SpillSlot {
+        std::atomic<std::size_t> sequence;
+        T item;
+    };
+
+    // Anything reserved in the spill file and not yet moved back into the ring counts as spilling.
+    [[nodiscard]] auto spilling() const -> bool
+    {
+        return m_spillTail.load(std::memory_order_relaxed) != m_spillHead.load(std::memory_order_acquire);
+    }
+
+    auto spill(const T& item) -> bool
+    {
+        SharedMemory* file { spillFile() };
+        if (file == nullptr) {
+            return false;
+        }
+
+        std::size_t pos { m_spillTail.load(std::memory_order_relaxed) };
+        do {
+            // A stale tail can trail the head, which the failed CAS then corrects.
+            const auto used { static_cast<std::ptrdiff_t>(pos - m_spillHead.load(std::memory_order_acquire)) };
+            if (used >= static_cast<std::ptrdiff_t>(SpillCapacity)) {
+                return false;
+            }
+        } while (!m_spillTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed));
+
+        SpillSlot& slot { slotAt(*file, pos) };
+        std::memcpy(&slot.item, &item, sizeof(T));
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Tops the ring back up to its high-water mark, stopping at the first slot whose producer is still writing it.
+    // Producers go back to the ring only once the head catches up with the tail, and the release store makes every
+    // refilled item visible before they do.
+    void refill()
+    {
+        SharedMemory* file { m_file.load(std::memory_order_acquire) };
+        std::size_t head { m_spillHead.load(std::memory_order_relaxed) };
+        while (head != m_spillTail.load(std::memory_order_relaxed) && m_ring.size() < m_highWaterMark) {
+            const SpillSlot& slot { slotAt(*file, head) };
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+                break;
+            }
+            T item {};
+            std::memcpy(&item, &slot.item, sizeof(T));
+            if (!m_ring.enqueue(item)) {
+                break;
+            }
+            m_spillHead.store(++head, std::memory_order_release);
+        }
+    }
+
+    // Creates the spill file on first use. Racing producers each create one and all but the first discard theirs.
+    auto spillFile() -> SharedMemory*
+    {
+        SharedMemory* file { m_file.load(std::memory_order_acquire) };
+        if (file != nullptr) {
+            return file;
+        }
+        std::optional<SharedMemory> created { SharedMemory::createTemporaryFile(m_directory.c_str(), SpillCapacity * sizeof(SpillSlot)) };
+        if (!created) {
+            return nullptr;
+        }
+        auto* candidate { new SharedMemory { std::move(*created) } };
+        if (m_file.compare_exchange_strong(file, candidate, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return candidate;
+        }
+        delete candidate;
+        return file;
+    }
+
+    static auto slotAt(SharedMemory& file, std::size_t index) -> SpillSlot&
+    {
+        return static_cast<SpillSlot*>(file.data())[index & (SpillCapacity - 1)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    Queue<T, Capacity> m_ring {};
+    std::string m_directory;
+    std::size_t m_highWaterMark;
+    std::atomic<SharedMemory*> m_file { nullptr };
+
+    // Pad as necessary to avoid false sharing. Producers only write the tail, and only on the spill path.
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> m_spillTail { 0 };
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> m_spillHead { 0 };
+    alignas(Blockbuster::cacheLineSize) std::mutex m_mutex {};
+};
+
+} // namespace Blockbuster::Mpmc
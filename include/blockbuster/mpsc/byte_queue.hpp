@@ -0,0 +1,239 @@
+#pragma once
+#include "../common.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+
+namespace Blockbuster::Mpsc {
+
+/**
+ * @brief A lock-free Multi-Producer Single-Consumer (MPSC) queue of variable-length byte records.
+ *
+ * Producers claim a length-prefixed region with a single compare-and-swap on the write cursor, fill it in place and
+ * commit it by publishing its header. The consumer walks committed records in claim order, stopping at the first one
+ * that is still being written, and releases everything it consumed in one step by zeroing the region and advancing
+ * the read cursor. As in Spsc::ByteQueue, records are 8-byte aligned and never straddle the end of the buffer.
+ *
+ * @tparam Capacity The size of the buffer in bytes. Must be a power of 2 and at least 16.
+ * @note A single record can hold at most (Capacity / 2 - 8) bytes, so that it fits regardless of the wrap point.
+ */
+template <std::size_t Capacity>
+class ByteQueue {
+public:
+    /**
+     * @brief A claimed but not yet committed region of the buffer.
+     */
+    struct Reservation {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    ByteQueue() = default;
+    ~ByteQueue() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    ByteQueue(const ByteQueue&) = delete;
+    auto operator=(const ByteQueue&) -> ByteQueue& = delete;
+    ByteQueue(ByteQueue&&) = delete;
+    auto operator=(ByteQueue&&) -> ByteQueue& = delete;
+
+    /**
+     * @brief Claims space for a record.
+     *
+     * @param size The maximum payload size the caller intends to write.
+     * @return The claimed region, or std::nullopt if there is not enough free space.
+     * @note Every successful reserve() must eventually be committed, as the consumer cannot pass an open record.
+     */
+    auto reserve(std::size_t size) -> std::optional<Reservation>
+    {
+        if (size > maxRecordSize()) {
+            return std::nullopt;
+        }
+
+        const std::size_t stride { strideOf(size) };
+        std::size_t tail { m_tail.load(std::memory_order_relaxed) };
+        std::size_t padding {};
+
+        do {
+            const std::size_t contiguous { s_capacity - wrap(tail) };
+            padding = stride <= contiguous ? 0 : contiguous;
+            if (tail + padding + stride - m_head.load(std::memory_order_acquire) > s_capacity) {
+                return std::nullopt;
+            }
+        } while (!m_tail.compare_exchange_weak(tail, tail + padding + stride, std::memory_order_relaxed));
+
+        if (padding != 0) {
+            header(wrap(tail)).store(pack(padding, s_paddingMarker), std::memory_order_release);
+        }
+        return Reservation { &m_buffer[wrap(tail + padding) + s_headerSize], size };
+    }
+
+    /**
+     * @brief Commits a reserved record, making it visible to the consumer.
+     *
+     * @param reservation The region returned by reserve().
+     * @param size The number of bytes actually written, which must not exceed the reserved size.
+     */
+    void commit(const Reservation& reservation, std::size_t size)
+    {
+        const auto offset { static_cast<std::size_t>(reservation.data - m_buffer.data()) - s_headerSize };
+        header(offset).store(pack(strideOf(reservation.size), size), std::memory_order_release);
+    }
+
+    /**
+     * @brief Commits a reserved record whose whole reserved size was written.
+     *
+     * @param reservation The region returned by reserve().
+     */
+    void commit(const Reservation& reservation)
+    {
+        commit(reservation, reservation.size);
+    }
+
+    /**
+     * @brief Copies a record into the queue.
+     *
+     * @param data The payload to copy.
+     * @param size The payload size in bytes.
+     * @return true if the record was successfully enqueued, false if the queue was full.
+     */
+    auto enqueue(const void* data, std::size_t size) -> bool
+    {
+        const std::optional<Reservation> reservation { reserve(size) };
+        if (!reservation) {
+            return false;
+        }
+        std::memcpy(reservation->data, data, size);
+        commit(*reservation);
+        return true;
+    }
+
+    /**
+     * @brief Passes committed records to a handler in order, then releases their space (consumer only).
+     *
+     * @tparam Handler A callable invoked as handler(const std::byte* data, std::size_t size).
+     * @param handler The handler. The data pointer is only valid for the duration of the call.
+     * @param limit The maximum number of records to consume.
+     * @return The number of records consumed.
+     */
+    template <typename Handler>
+    auto consume(Handler&& handler, std::size_t limit = std::numeric_limits<std::size_t>::max()) -> std::size_t
+    {
+        const std::size_t head { m_head.load(std::memory_order_relaxed) };
+        std::size_t position { head };
+        std::size_t count { 0 };
+
+        // A full buffer wraps back onto records consumed in this pass, which are only zeroed afterwards.
+        while (count < limit && position - head < s_capacity) {
+            const std::uint64_t word { header(wrap(position)).load(std::memory_order_acquire) };
+            if (word == 0) {
+                break;
+            }
+            const auto size { static_cast<std::uint32_t>(word) };
+            if (size != s_paddingMarker) {
+                handler(static_cast<const std::byte*>(&m_buffer[wrap(position) + s_headerSize]),
+                    static_cast<std::size_t>(size));
+                ++count;
+            }
+            position += static_cast<std::size_t>(word >> 32);
+        }
+
+        if (position != head) {
+            // Headers of future records can land at any 8-byte offset in the released region, so every word must be
+            // reset, through the atomic that producers will later access it as.
+            for (std::size_t offset { head }; offset != position; offset += s_headerSize) {
+                header(wrap(offset)).store(0, std::memory_order_relaxed);
+            }
+            m_head.store(position, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of buffer bytes claimed, including headers, padding and uncommitted records.
+     *
+     * @return The number of used bytes.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto usedBytes() const -> std::size_t
+    {
+        return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the capacity of the buffer.
+     *
+     * @return The size of the buffer in bytes.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return s_capacity;
+    }
+
+    /**
+     * @brief Returns the largest payload a single record can hold.
+     *
+     * @return The maximum record size in bytes.
+     */
+    [[nodiscard]] static constexpr auto maxRecordSize() -> std::size_t
+    {
+        return s_capacity / 2 - s_headerSize;
+    }
+
+private:
+    static constexpr std::size_t s_capacity { Capacity }; // NOLINT(readability-identifier-naming)
+    static_assert(s_capacity >= 16 && (s_capacity & (s_capacity - 1)) == 0, "Capacity must be at least 16 and a power of 2");
+    static_assert(s_capacity / 2 <= std::numeric_limits<std::uint32_t>::max(), "Capacity must fit record strides in 32 bits");
+
+    // A header packs the record stride into the upper 32 bits and the payload size into the lower 32 bits. A zero header
+    // marks a record that has not been committed yet.
+    static constexpr std::size_t s_headerSize { 8 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint32_t s_paddingMarker { std::numeric_limits<std::uint32_t>::max() }; // NOLINT(readability-identifier-naming)
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free && sizeof(std::atomic<std::uint64_t>) == s_headerSize);
+
+    // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
+    [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
+    {
+        return index & (s_capacity - 1);
+    }
+
+    // Header plus payload, rounded up so that every header stays 8-byte aligned.
+    [[nodiscard]] static constexpr auto strideOf(std::size_t size) -> std::size_t
+    {
+        return (s_headerSize + size + s_headerSize - 1) & ~(s_headerSize - 1);
+    }
+
+    [[nodiscard]] static constexpr auto pack(std::size_t stride, std::size_t size) -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(stride) << 32) | static_cast<std::uint32_t>(size);
+    }
+
+    // Headers are accessed atomically in place; the buffer is aligned and sized so that every header slot is valid.
+    auto header(std::size_t offset) -> std::atomic<std::uint64_t>&
+    {
+        return *reinterpret_cast<std::atomic<std::uint64_t>*>(&m_buffer[offset]); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    alignas(s_headerSize) std::array<std::byte, s_capacity> m_buffer {};
+
+    // Pad as necessary to avoid false sharing.
+    alignas(cacheLineSize) std::atomic<std::size_t> m_tail { 0 };
+    alignas(cacheLineSize) std::atomic<std::size_t> m_head { 0 };
+};
+
+} // namespace Blockbuster::Mpsc
@@ -0,0 +1,209 @@
+#pragma once
+#include "../common.hpp"
+#include "../mpmc/queue.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace Blockbuster::Mpsc {
+
+/**
+ * @brief A Multi-Producer Single-Consumer (MPSC) queue that keeps only the latest value per key.
+ *
+ * Each key is assigned a slot once, through an open-addressing index. Enqueuing a key overwrites the value in its slot
+ * and, if the key was not already pending, queues the slot's index for the consumer. The consumer therefore receives
+ * each dirty key once with its latest value, so its work is bounded by the number of distinct keys rather than the
+ * number of updates. Values are written and read under a per-slot seqlock, so the consumer never sees a torn value.
+ *
+ * The queue is not lock-free. Looking up a key that is already indexed never waits, even past slots that other
+ * threads are still claiming. However, claiming a slot for a new key waits for earlier claims on its probe sequence,
+ * and writers and the reader of a key spin on its seqlock. A thread preempted in the middle of a claim or a write
+ * therefore stalls the other threads that need the same slot.
+ *
+ * @tparam Key The key type. Must be trivially copyable and equality comparable.
+ * @tparam Value The value type. Must be trivially copyable.
+ * @tparam Capacity The maximum number of distinct keys. Must be a power of 2; keep it at least twice the expected
+ * number of keys so that probe sequences stay short.
+ * @tparam Hash The hash function for keys.
+ * @note Concurrent updates to the same key are serialised by the seqlock; updates to different keys do not contend.
+ */
+template <typename Key, typename Value, std::size_t Capacity, typename Hash = std::hash<Key>>
+class ConflatingQueue {
+public:
+    ConflatingQueue() = default;
+    ~ConflatingQueue() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    auto operator=(const ConflatingQueue&) -> ConflatingQueue& = delete;
+    ConflatingQueue(ConflatingQueue&&) = delete;
+    auto operator=(ConflatingQueue&&) -> ConflatingQueue& = delete;
+
+    /**
+     * @brief Sets the latest value for a key, queuing the key if it is not already pending.
+     *
+     * @param key The key.
+     * @param value The value, which replaces any value still pending for the key.
+     * @return true if the value was stored, false if the key is new and every slot is taken by other keys.
+     */
+    auto enqueue(const Key& key, const Value& value) -> bool
+    {
+        Slot* slot { find(key) };
+        if (slot == nullptr) {
+            return false;
+        }
+
+        // Writers take the seqlock by making the sequence odd, which also keeps other writers of the key out.
+        std::uint64_t sequence { slot->sequence.load(std::memory_order_relaxed) };
+        while ((sequence & 1U) != 0
+            || !slot->sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            sequence = slot->sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->value = value;
+        slot->sequence.store(sequence + 2, std::memory_order_release);
+
+        if (!slot->pending.exchange(true, std::memory_order_acq_rel)) {
+            // Each slot is queued at most once at a time, so the ring can never be full.
+            m_pending.enqueue(static_cast<std::uint32_t>(slot - m_slots.data()));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Takes the next pending key and its latest value (consumer only).
+     *
+     * @return An optional containing the key and value, or std::nullopt if no key is pending.
+     */
+    auto dequeue() -> std::optional<std::pair<Key, Value>>
+    {
+        const std::optional<std::uint32_t> index { m_pending.dequeue() };
+        if (!index) {
+            return std::nullopt;
+        }
+
+        // Clearing the flag before reading means an update racing with the read queues the key again. The exchange
+        // synchronises with the last writer that found the key pending, so its value is visible below.
+        Slot& slot { m_slots[*index] };
+        slot.pending.exchange(false, std::memory_order_acq_rel);
+        for (;;) {
+            const std::uint64_t before { slot.sequence.load(std::memory_order_acquire) };
+            if ((before & 1U) == 0) {
+                const Value value { slot.value };
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                    return std::pair<Key, Value> { slot.key, value };
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Checks if no key is pending.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return m_pending.empty();
+    }
+
+    /**
+     * @brief Returns the number of pending keys.
+     *
+     * @return The number of pending keys.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_pending.size();
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of distinct keys.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return Capacity;
+    }
+
+private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be greater than 0 and a power of 2");
+    static_assert(Capacity <= std::numeric_limits<std::uint32_t>::max(), "Capacity must fit slot indices in 32 bits");
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+        "Keys and values must be trivially copyable to be read optimistically");
+
+    enum class State : std::uint8_t {
+        empty,
+        claiming,
+        ready
+    };
+
+    // Slots are padded to a cache line so that updates to different keys never contend.
+    struct alignas(Blockbuster::cacheLineSize) Slot {
+        std::atomic<State> state { State::empty };
+        std::atomic<bool> pending { false };
+        std::atomic<std::uint64_t> sequence { 0 };
+        Key key {};
+        Value value {};
+    };
+
+    // Linear probing from a mixed hash. A slot is claimed for a key exactly once and never released, so a key found
+    // ready can be used without further synchronisation. Slots still being claimed are skipped, as the key may well
+    // be further along; only claiming a new slot waits for them, since one of them might be for the same key.
+    auto find(const Key& key) -> Slot*
+    {
+        // Fibonacci hashing spreads identity hashes such as those of integer keys.
+        const std::size_t start { static_cast<std::size_t>((static_cast<std::uint64_t>(Hash {}(key)) * 0x9E3779B97F4A7C15U) >> 32) };
+
+        for (;;) {
+            bool skippedClaim { false };
+            for (std::size_t probe { 0 }; probe < Capacity; ++probe) {
+                Slot& slot { m_slots[wrap(start + probe)] };
+                State state { slot.state.load(std::memory_order_acquire) };
+
+                if (state == State::empty) {
+                    if (skippedClaim) {
+                        break;
+                    }
+                    if (slot.state.compare_exchange_strong(state, State::claiming, std::memory_order_acquire)) {
+                        slot.key = key;
+                        slot.state.store(State::ready, std::memory_order_release);
+                        return &slot;
+                    }
+                }
+                if (state == State::claiming) {
+                    skippedClaim = true;
+                } else if (slot.key == key) {
+                    return &slot;
+                }
+            }
+            if (!skippedClaim) {
+                return nullptr;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
+    [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
+    {
+        return index & (Capacity - 1);
+    }
+
+    std::array<Slot, Capacity> m_slots {};
+    Mpmc::Queue<std::uint32_t, Capacity> m_pending {};
+};
+
+} // namespace Blockbuster::Mpsc
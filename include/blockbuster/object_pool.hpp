@@ -0,0 +1,305 @@
+#pragma once
+#include "common.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace Blockbuster {
+
+/**
+ * @brief A lock-free fixed-capacity object pool.
+ *
+ * Objects live in a preallocated array of cache-line aligned slots and are handed out either as pointers or as
+ * compact 32-bit handles, so producers can acquire a slot, fill it in place and enqueue the handle on a Spsc::Queue or
+ * Mpmc::Queue, and consumers release it back without touching the allocator.
+ *
+ * Free slots are kept on a shared lock-free stack (tagged to avoid ABA). Threads with a high acquire/release rate
+ * should go through a per-thread Cache, which moves slots to and from the shared stack in batches.
+ *
+ * @tparam T The type of the pooled objects. Must be default constructible; objects are not reset on release.
+ * @tparam Capacity The number of objects in the pool.
+ * @tparam CacheSize The number of free slots a per-thread Cache can hold.
+ */
+template <typename T, std::size_t Capacity, std::size_t CacheSize = 32>
+class ObjectPool {
+public:
+    /**
+     * @brief A compact reference to a pooled object.
+     */
+    using Handle = std::uint32_t;
+
+    /**
+     * @brief The handle value that never refers to an object.
+     */
+    static constexpr Handle nullHandle { std::numeric_limits<Handle>::max() };
+
+    /**
+     * @brief A per-thread cache of free slots.
+     *
+     * A cache must only be used by one thread at a time. Slots it still holds are returned to the pool on destruction.
+     */
+    class Cache {
+    public:
+        ~Cache()
+        {
+            while (m_count > 0) {
+                m_pool->push(m_slots[--m_count]);
+            }
+        }
+
+        Cache(const Cache&) = delete;
+        auto operator=(const Cache&) -> Cache& = delete;
+        Cache(Cache&&) = delete;
+        auto operator=(Cache&&) -> Cache& = delete;
+
+        /**
+         * @brief Acquires an object handle, refilling the cache from the pool if it is empty.
+         *
+         * @return A handle to a free object, or std::nullopt if the pool is exhausted.
+         */
+        auto acquireHandle() -> std::optional<Handle>
+        {
+            if (m_count == 0) {
+                while (m_count < CacheSize / 2 + 1) {
+                    const Handle handle { m_pool->pop() };
+                    if (handle == nullHandle) {
+                        break;
+                    }
+                    m_slots[m_count++] = handle;
+                }
+                if (m_count == 0) {
+                    return std::nullopt;
+                }
+            }
+            return m_slots[--m_count];
+        }
+
+        /**
+         * @brief Acquires an object.
+         *
+         * @return A pointer to a free object, or nullptr if the pool is exhausted.
+         */
+        auto acquire() -> T*
+        {
+            const std::optional<Handle> handle { acquireHandle() };
+            return handle ? &m_pool->get(*handle) : nullptr;
+        }
+
+        /**
+         * @brief Releases an object handle, flushing half the cache to the pool if it is full.
+         *
+         * @param handle A handle previously acquired from the same pool.
+         */
+        void release(Handle handle)
+        {
+            if (m_count == CacheSize) {
+                const std::size_t keep { CacheSize / 2 };
+                m_pool->pushChain(&m_slots[keep], m_count - keep);
+                m_count = keep;
+            }
+            m_slots[m_count++] = handle;
+        }
+
+        /**
+         * @brief Releases an object.
+         *
+         * @param object A pointer previously acquired from the same pool.
+         */
+        void release(T* object)
+        {
+            release(m_pool->handleOf(object));
+        }
+
+    private:
+        friend class ObjectPool;
+
+        explicit Cache(ObjectPool* pool)
+            : m_pool { pool }
+        {
+        }
+
+        ObjectPool* m_pool;
+        std::array<Handle, CacheSize> m_slots {};
+        std::size_t m_count { 0 };
+    };
+
+    ObjectPool()
+    {
+        for (std::size_t i { 0 }; i < s_capacity; ++i) {
+            m_slots[i].next.store(i + 1 < s_capacity ? static_cast<Handle>(i + 1) : nullHandle,
+                std::memory_order_relaxed);
+        }
+        m_head.store(pack(0, 0), std::memory_order_relaxed);
+    }
+    ~ObjectPool() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    ObjectPool(const ObjectPool&) = delete;
+    auto operator=(const ObjectPool&) -> ObjectPool& = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    auto operator=(ObjectPool&&) -> ObjectPool& = delete;
+
+    /**
+     * @brief Creates a per-thread cache bound to this pool.
+     *
+     * @return The cache.
+     */
+    auto makeCache() -> Cache
+    {
+        return Cache { this };
+    }
+
+    /**
+     * @brief Acquires an object handle directly from the shared free-list.
+     *
+     * @return A handle to a free object, or std::nullopt if the pool is exhausted.
+     */
+    auto acquireHandle() -> std::optional<Handle>
+    {
+        const Handle handle { pop() };
+        if (handle == nullHandle) {
+            return std::nullopt;
+        }
+        return handle;
+    }
+
+    /**
+     * @brief Acquires an object directly from the shared free-list.
+     *
+     * @return A pointer to a free object, or nullptr if the pool is exhausted.
+     */
+    auto acquire() -> T*
+    {
+        const Handle handle { pop() };
+        return handle == nullHandle ? nullptr : &get(handle);
+    }
+
+    /**
+     * @brief Releases an object handle directly to the shared free-list.
+     *
+     * @param handle A handle previously acquired from this pool.
+     */
+    void release(Handle handle)
+    {
+        push(handle);
+    }
+
+    /**
+     * @brief Releases an object directly to the shared free-list.
+     *
+     * @param object A pointer previously acquired from this pool.
+     */
+    void release(T* object)
+    {
+        push(handleOf(object));
+    }
+
+    /**
+     * @brief Resolves a handle to its object.
+     *
+     * @param handle A handle acquired from this pool.
+     * @return A reference to the object.
+     */
+    [[nodiscard]] auto get(Handle handle) -> T&
+    {
+        return m_slots[handle].value;
+    }
+
+    /**
+     * @brief Resolves a handle to its object.
+     *
+     * @param handle A handle acquired from this pool.
+     * @return A const reference to the object.
+     */
+    [[nodiscard]] auto get(Handle handle) const -> const T&
+    {
+        return m_slots[handle].value;
+    }
+
+    /**
+     * @brief Returns the handle of a pooled object.
+     *
+     * @param object A pointer to an object owned by this pool.
+     * @return The object's handle.
+     */
+    [[nodiscard]] auto handleOf(const T* object) const -> Handle
+    {
+        // Every object lies inside its own slot, so the byte offset rounds down to the slot index.
+        const auto offset { reinterpret_cast<std::uintptr_t>(object) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            - reinterpret_cast<std::uintptr_t>(m_slots.data()) }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return static_cast<Handle>(offset / sizeof(Slot));
+    }
+
+    /**
+     * @brief Returns the capacity of the pool.
+     *
+     * @return The number of objects owned by the pool.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return s_capacity;
+    }
+
+private:
+    struct alignas(cacheLineSize) Slot {
+        T value {};
+        std::atomic<Handle> next { nullHandle };
+    };
+
+    static constexpr std::size_t s_capacity { Capacity }; // NOLINT(readability-identifier-naming)
+    static_assert(s_capacity > 0 && s_capacity < nullHandle, "Capacity must be greater than 0 and fit in a handle");
+    static_assert(CacheSize >= 2, "CacheSize must be at least 2");
+
+    // The free-list head packs an ABA tag into the upper 32 bits and the top slot's handle into the lower 32 bits.
+    static auto pack(std::uint32_t tag, Handle handle) -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(tag) << 32) | handle;
+    }
+
+    auto pop() -> Handle
+    {
+        std::uint64_t head { m_head.load(std::memory_order_acquire) };
+
+        for (;;) {
+            const auto handle { static_cast<Handle>(head) };
+            if (handle == nullHandle) {
+                return nullHandle;
+            }
+            const Handle next { m_slots[handle].next.load(std::memory_order_relaxed) };
+            if (m_head.compare_exchange_weak(head, pack(static_cast<std::uint32_t>(head >> 32) + 1, next),
+                    std::memory_order_acquire, std::memory_order_acquire)) {
+                return handle;
+            }
+        }
+    }
+
+    void push(Handle handle)
+    {
+        pushChain(&handle, 1);
+    }
+
+    // Links the handles together and publishes them with a single exchange.
+    void pushChain(const Handle* handles, std::size_t count)
+    {
+        for (std::size_t i { 0 }; i + 1 < count; ++i) {
+            m_slots[handles[i]].next.store(handles[i + 1], std::memory_order_relaxed);
+        }
+
+        Slot& last { m_slots[handles[count - 1]] };
+        std::uint64_t head { m_head.load(std::memory_order_relaxed) };
+        do {
+            last.next.store(static_cast<Handle>(head), std::memory_order_relaxed);
+        } while (!m_head.compare_exchange_weak(head, pack(static_cast<std::uint32_t>(head >> 32) + 1, handles[0]),
+            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    std::array<Slot, s_capacity> m_slots {};
+
+    // Pad as necessary to avoid false sharing.
+    alignas(cacheLineSize) std::atomic<std::uint64_t> m_head { 0 };
+};
+
+} // namespace Blockbuster
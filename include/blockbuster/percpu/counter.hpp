@@ -0,0 +1,87 @@
+#pragma once
+#include "../common.hpp"
+#include "rseq.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Blockbuster::PerCpu {
+
+/**
+ * @brief A concurrent counter with one cell per CPU, updated without atomic read-modify-writes.
+ *
+ * With restartable sequences, add() is a plain add to the current CPU's cell that the kernel restarts if the thread
+ * is preempted or migrated, so increments never bounce cache lines between cores or pay for a locked instruction.
+ * Threads without restartable sequences fall back to atomic adds on separate per-thread cells.
+ */
+class Counter {
+public:
+    Counter() = default;
+    ~Counter() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Counter(const Counter&) = delete;
+    auto operator=(const Counter&) -> Counter& = delete;
+    Counter(Counter&&) = delete;
+    auto operator=(Counter&&) -> Counter& = delete;
+
+    /**
+     * @brief Adds to the counter.
+     *
+     * @param delta The amount to add, which may be negative.
+     */
+    void add(std::int64_t delta = 1)
+    {
+#if BLOCKBUSTER_HAS_RSEQ
+        if (struct rseq* area { Detail::rseqArea() }) {
+            for (;;) {
+                const std::uint32_t cpu { Detail::rseqCpu(area) };
+                if (cpu >= cpuCount()) {
+                    break;
+                }
+                if (Detail::rseqAdd(area, cpu, &m_cells[cpu].value, delta)) {
+                    return;
+                }
+            }
+        }
+#endif
+        m_fallback[Blockbuster::Detail::threadIndex() & (s_fallbackCells - 1)].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the value by adding up every cell.
+     *
+     * @return The value.
+     * @note This is exact once concurrent adds have returned; adds in flight may or may not be included.
+     */
+    [[nodiscard]] auto sum() const -> std::int64_t
+    {
+        std::int64_t total { 0 };
+        for (std::size_t cpu { 0 }; cpu < cpuCount(); ++cpu) {
+            total += __atomic_load_n(&m_cells[cpu].value, __ATOMIC_RELAXED);
+        }
+        for (const FallbackCell& cell : m_fallback) {
+            total += cell.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    static constexpr std::size_t s_fallbackCells { 16 }; // NOLINT(readability-identifier-naming)
+
+    // Pad as necessary to avoid false sharing. Cells are only written by restartable sequences on their own CPU.
+    struct alignas(Blockbuster::cacheLineSize) Cell {
+        std::int64_t value { 0 };
+    };
+
+    struct alignas(Blockbuster::cacheLineSize) FallbackCell {
+        std::atomic<std::int64_t> value { 0 };
+    };
+
+    std::unique_ptr<Cell[]> m_cells { std::make_unique<Cell[]>(cpuCount()) }; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    std::array<FallbackCell, s_fallbackCells> m_fallback {};
+};
+
+} // namespace Blockbuster::PerCpu
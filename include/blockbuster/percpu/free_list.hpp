@@ -0,0 +1,139 @@
+#pragma once
+#include "../common.hpp"
+#include "rseq.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Blockbuster::PerCpu {
+
+/**
+ * @brief The link embedded in every node of a FreeList.
+ */
+struct FreeListNode {
+    FreeListNode* next { nullptr };
+};
+
+/**
+ * @brief An intrusive free-list with one stack per CPU, e.g. to cache released objects close to where they are reused.
+ *
+ * With restartable sequences, push() and pop() work on the current CPU's stack without atomic read-modify-writes;
+ * because the kernel restarts a sequence whenever its thread is preempted, no other thread can interleave and the
+ * stacks are immune to ABA. Threads without restartable sequences fall back to spinlocked per-thread stacks.
+ *
+ * @tparam T The node type. Must derive from FreeListNode.
+ * @note pop() only looks at the current CPU's stack, so it may return nullptr while other CPUs hold nodes; callers
+ * are expected to fall back to a shared source, as with any per-CPU cache.
+ */
+template <typename T>
+class FreeList {
+public:
+    FreeList() = default;
+    ~FreeList() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    FreeList(const FreeList&) = delete;
+    auto operator=(const FreeList&) -> FreeList& = delete;
+    FreeList(FreeList&&) = delete;
+    auto operator=(FreeList&&) -> FreeList& = delete;
+
+    /**
+     * @brief Pushes a node onto the current CPU's stack.
+     *
+     * @param node The node, which the list does not take ownership of.
+     */
+    void push(T* node)
+    {
+        FreeListNode* const link { node };
+#if BLOCKBUSTER_HAS_RSEQ
+        if (struct rseq* area { Detail::rseqArea() }) {
+            for (;;) {
+                const std::uint32_t cpu { Detail::rseqCpu(area) };
+                if (cpu >= cpuCount()) {
+                    break;
+                }
+                FreeListNode* const head { __atomic_load_n(&m_stacks[cpu].head, __ATOMIC_RELAXED) };
+                link->next = head;
+                if (Detail::rseqCompareStore(area, cpu, headAddress(m_stacks[cpu]), head, link) == 0) {
+                    return;
+                }
+            }
+        }
+#endif
+        FallbackStack& stack { fallbackStack() };
+        lock(stack);
+        link->next = stack.head;
+        stack.head = link;
+        stack.locked.clear(std::memory_order_release);
+    }
+
+    /**
+     * @brief Pops a node from the current CPU's stack.
+     *
+     * @return The node, or nullptr if the current CPU's stack is empty.
+     */
+    auto pop() -> T*
+    {
+#if BLOCKBUSTER_HAS_RSEQ
+        if (struct rseq* area { Detail::rseqArea() }) {
+            for (;;) {
+                const std::uint32_t cpu { Detail::rseqCpu(area) };
+                if (cpu >= cpuCount()) {
+                    break;
+                }
+                void* popped { nullptr };
+                const int result { Detail::rseqPop(area, cpu, headAddress(m_stacks[cpu]), &popped) };
+                if (result >= 0) {
+                    return result == 0 ? static_cast<T*>(static_cast<FreeListNode*>(popped)) : nullptr;
+                }
+            }
+        }
+#endif
+        FallbackStack& stack { fallbackStack() };
+        lock(stack);
+        FreeListNode* const head { stack.head };
+        if (head != nullptr) {
+            stack.head = head->next;
+        }
+        stack.locked.clear(std::memory_order_release);
+        return static_cast<T*>(head);
+    }
+
+private:
+    static_assert(std::is_base_of_v<FreeListNode, T>, "Nodes must derive from FreeListNode");
+    static constexpr std::size_t s_fallbackStacks { 16 }; // NOLINT(readability-identifier-naming)
+
+    // Pad as necessary to avoid false sharing. Stacks are only modified by restartable sequences on their own CPU.
+    struct alignas(Blockbuster::cacheLineSize) Stack {
+        FreeListNode* head { nullptr };
+    };
+
+    struct alignas(Blockbuster::cacheLineSize) FallbackStack {
+        std::atomic_flag locked = ATOMIC_FLAG_INIT;
+        FreeListNode* head { nullptr };
+    };
+
+    static auto headAddress(Stack& stack) -> void**
+    {
+        return reinterpret_cast<void**>(&stack.head); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    auto fallbackStack() -> FallbackStack&
+    {
+        return m_fallback[Blockbuster::Detail::threadIndex() & (s_fallbackStacks - 1)];
+    }
+
+    static void lock(FallbackStack& stack)
+    {
+        while (stack.locked.test_and_set(std::memory_order_acquire)) {
+        }
+    }
+
+    std::unique_ptr<Stack[]> m_stacks { std::make_unique<Stack[]>(cpuCount()) }; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    std::array<FallbackStack, s_fallbackStacks> m_fallback {};
+};
+
+} // namespace Blockbuster::PerCpu
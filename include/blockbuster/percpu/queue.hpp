@@ -0,0 +1,106 @@
+#pragma once
+#include "../mpmc/queue.hpp"
+#include "rseq.hpp"
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace Blockbuster::PerCpu {
+
+/**
+ * @brief A Multi-Producer Multi-Consumer (MPMC) queue sharded into one Mpmc::Queue per CPU.
+ *
+ * Producers and consumers start at the shard of the CPU they are running on, found through restartable sequences
+ * where available, so the cursors they contend on usually stay in the local core's cache. They only move on to other
+ * shards when their own is full or empty.
+ *
+ * @tparam T The type of elements stored in the queue.
+ * @tparam Capacity The capacity of each shard. Must be a power of 2.
+ * @note Elements from the same producer may be dequeued out of order if the producer migrates between CPUs.
+ */
+template <typename T, std::size_t Capacity>
+class Queue {
+public:
+    Queue() = default;
+    ~Queue() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Queue(const Queue&) = delete;
+    auto operator=(const Queue&) -> Queue& = delete;
+    Queue(Queue&&) = delete;
+    auto operator=(Queue&&) -> Queue& = delete;
+
+    /**
+     * @brief Enqueues an item on the current CPU's shard, or the next one with room.
+     *
+     * @param item The item to enqueue.
+     * @return true if the item was successfully enqueued, false if every shard was full.
+     */
+    auto enqueue(const T& item) -> bool
+    {
+        const std::size_t start { currentCpu() };
+        for (std::size_t i { 0 }; i < cpuCount(); ++i) {
+            if (m_shards[(start + i) % cpuCount()].enqueue(item)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Dequeues an item from the current CPU's shard, or the next one that is not empty.
+     *
+     * @return An optional containing the dequeued item if successful, or std::nullopt if every shard was empty.
+     */
+    auto dequeue() -> std::optional<T>
+    {
+        const std::size_t start { currentCpu() };
+        for (std::size_t i { 0 }; i < cpuCount(); ++i) {
+            if (std::optional<T> item { m_shards[(start + i) % cpuCount()].dequeue() }) {
+                return item;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the current number of elements across every shard.
+     *
+     * @return The current number of elements in the queue.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        std::size_t total { 0 };
+        for (std::size_t i { 0 }; i < cpuCount(); ++i) {
+            total += m_shards[i].size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of elements the queue can hold across every shard.
+     */
+    [[nodiscard]] auto capacity() const -> std::size_t
+    {
+        return Capacity * cpuCount();
+    }
+
+private:
+    std::unique_ptr<Mpmc::Queue<T, Capacity>[]> m_shards { std::make_unique<Mpmc::Queue<T, Capacity>[]>(cpuCount()) }; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+
+} // namespace Blockbuster::PerCpu
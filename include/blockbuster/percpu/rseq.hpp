@@ -0,0 +1,185 @@
+#pragma once
+#include "../common.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <sched.h>
+#include <sys/sysinfo.h>
+#if __has_include(<sys/rseq.h>)
+#include <sys/rseq.h>
+#endif
+
+// Restartable sequences need glibc 2.35+ (which registers them for every thread) and per-architecture assembly, which
+// is only provided for x86-64. Define BLOCKBUSTER_DISABLE_RSEQ to force the atomic fallback everywhere.
+#if defined(__x86_64__) && defined(RSEQ_SIG) && !defined(BLOCKBUSTER_DISABLE_RSEQ)
+#define BLOCKBUSTER_HAS_RSEQ 1
+#else
+#define BLOCKBUSTER_HAS_RSEQ 0
+#endif
+
+namespace Blockbuster::PerCpu {
+
+/**
+ * @brief Returns the number of CPUs that may ever be online, which bounds every CPU number.
+ *
+ * @return The number of configured CPUs.
+ */
+inline auto cpuCount() -> std::size_t
+{
+    static const std::size_t count { static_cast<std::size_t>(std::max(::get_nprocs_conf(), 1)) };
+    return count;
+}
+
+namespace Detail {
+
+#if BLOCKBUSTER_HAS_RSEQ
+    // The calling thread's registered rseq area, or nullptr if registration failed or was disabled.
+    inline auto rseqArea() -> struct rseq*
+    {
+        if (__rseq_size == 0) {
+            return nullptr;
+        }
+        auto* area { reinterpret_cast<struct rseq*>(static_cast<char*>(__builtin_thread_pointer()) + __rseq_offset) }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return static_cast<std::int32_t>(__atomic_load_n(&area->cpu_id, __ATOMIC_RELAXED)) >= 0 ? area : nullptr;
+    }
+
+    inline auto rseqCpu(struct rseq* area) -> std::uint32_t
+    {
+        return __atomic_load_n(&area->cpu_id_start, __ATOMIC_RELAXED);
+    }
+
+// Every critical section registers a descriptor (start, length of the section up to its commit, abort handler) in
+// the __rseq_cs section, points the thread's rseq area at it, and then checks that the thread is still on the
+// expected CPU. If the thread is preempted, migrated or signalled before the commit instruction completes, the kernel
+// jumps to the abort handler, which must be preceded by the signature glibc registered.
+#define BLOCKBUSTER_RSEQ_STR(x) #x
+#define BLOCKBUSTER_RSEQ_XSTR(x) BLOCKBUSTER_RSEQ_STR(x)
+#define BLOCKBUSTER_RSEQ_BEGIN                  \
+    ".pushsection __rseq_cs, \"aw\"\n\t"        \
+    ".balign 32\n\t"                            \
+    "3:\n\t"                                    \
+    ".long 0x0, 0x0\n\t"                        \
+    ".quad 1f, (2f - 1f), 4f\n\t"               \
+    ".popsection\n\t"                           \
+    "leaq 3b(%%rip), %%rax\n\t"                 \
+    "movq %%rax, %[rseqCs]\n\t"                 \
+    "1:\n\t"                                    \
+    "cmpl %[cpu], %[currentCpu]\n\t"            \
+    "jnz 4f\n\t"
+#define BLOCKBUSTER_RSEQ_END                                      \
+    "2:\n\t"                                                      \
+    ".pushsection __rseq_failure, \"ax\"\n\t"                     \
+    ".byte 0x0f, 0xb9, 0x3d\n\t"                                  \
+    ".long " BLOCKBUSTER_RSEQ_XSTR(RSEQ_SIG) "\n\t"               \
+    "4:\n\t"                                                      \
+    "jmp %l[abort]\n\t"                                           \
+    ".popsection\n\t"
+
+    // Adds to a per-CPU value without atomics. Returns false if the thread was not on the CPU or was interrupted.
+    inline auto rseqAdd(struct rseq* area, std::uint32_t cpu, std::int64_t* target, std::int64_t delta) -> bool
+    {
+        __asm__ __volatile__ goto( // NOLINT(hicpp-no-assembler)
+            BLOCKBUSTER_RSEQ_BEGIN
+            "addq %[delta], %[target]\n\t"
+            BLOCKBUSTER_RSEQ_END
+            :
+            : [cpu] "r"(cpu), [currentCpu] "m"(area->cpu_id), [rseqCs] "m"(area->rseq_cs),
+            [target] "m"(*target), [delta] "er"(delta)
+            : "memory", "cc", "rax"
+            : abort);
+        return true;
+    abort:
+        return false;
+    }
+
+    // Replaces a per-CPU pointer if it still holds the expected value. Returns 0 on success, 1 if it held another
+    // value, and -1 if the thread was not on the CPU or was interrupted.
+    inline auto rseqCompareStore(struct rseq* area, std::uint32_t cpu, void** target, void* expected, void* desired) -> int
+    {
+        __asm__ __volatile__ goto( // NOLINT(hicpp-no-assembler)
+            BLOCKBUSTER_RSEQ_BEGIN
+            "cmpq %[target], %[expected]\n\t"
+            "jnz %l[mismatch]\n\t"
+            "movq %[desired], %[target]\n\t"
+            BLOCKBUSTER_RSEQ_END
+            :
+            : [cpu] "r"(cpu), [currentCpu] "m"(area->cpu_id), [rseqCs] "m"(area->rseq_cs),
+            [target] "m"(*target), [expected] "r"(expected), [desired] "r"(desired)
+            : "memory", "cc", "rax"
+            : abort, mismatch);
+        return 0;
+    mismatch:
+        return 1;
+    abort:
+        return -1;
+    }
+
+    // Pops the head of a per-CPU intrusive list whose nodes hold their next pointer at offset 0. Loading the head, its
+    // successor and storing the successor all happen inside the critical section, so no other thread can interleave.
+    // Returns 0 with the node in *popped, 1 if the list was empty, and -1 if the thread was not on the CPU or was
+    // interrupted.
+    inline auto rseqPop(struct rseq* area, std::uint32_t cpu, void** head, void** popped) -> int
+    {
+        __asm__ __volatile__ goto( // NOLINT(hicpp-no-assembler)
+            BLOCKBUSTER_RSEQ_BEGIN
+            "movq %[head], %%rax\n\t"
+            "testq %%rax, %%rax\n\t"
+            "jz %l[empty]\n\t"
+            "movq %%rax, %[popped]\n\t"
+            "movq (%%rax), %%rax\n\t"
+            "movq %%rax, %[head]\n\t"
+            BLOCKBUSTER_RSEQ_END
+            :
+            : [cpu] "r"(cpu), [currentCpu] "m"(area->cpu_id), [rseqCs] "m"(area->rseq_cs),
+            [head] "m"(*head), [popped] "m"(*popped)
+            : "memory", "cc", "rax"
+            : abort, empty);
+        return 0;
+    empty:
+        return 1;
+    abort:
+        return -1;
+    }
+
+#undef BLOCKBUSTER_RSEQ_BEGIN
+#undef BLOCKBUSTER_RSEQ_END
+#undef BLOCKBUSTER_RSEQ_XSTR
+#undef BLOCKBUSTER_RSEQ_STR
+#endif
+
+} // namespace Detail
+
+/**
+ * @brief Checks whether the calling thread updates per-CPU structures with restartable sequences.
+ *
+ * @return true if restartable sequences are in use, false if the thread falls back to atomics.
+ */
+inline auto rseqAvailable() -> bool
+{
+#if BLOCKBUSTER_HAS_RSEQ
+    return Detail::rseqArea() != nullptr;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Returns the CPU the calling thread is running on, which may change as soon as it returns.
+ *
+ * @return The CPU number, below cpuCount(), or a stable per-thread number if it cannot be determined.
+ */
+inline auto currentCpu() -> std::size_t
+{
+#if BLOCKBUSTER_HAS_RSEQ
+    if (struct rseq* area { Detail::rseqArea() }) {
+        return Detail::rseqCpu(area);
+    }
+#endif
+    const int cpu { ::sched_getcpu() };
+    if (cpu >= 0 && static_cast<std::size_t>(cpu) < cpuCount()) {
+        return static_cast<std::size_t>(cpu);
+    }
+    return Blockbuster::Detail::threadIndex() % cpuCount();
+}
+
+} // namespace Blockbuster::PerCpu
@@ -0,0 +1,358 @@
+#pragma once
+#include "../common.hpp"
+#include "../fence.hpp"
+#include "retirable.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace Blockbuster::Reclamation {
+
+/**
+ * @brief An epoch-based reclamation (EBR) domain for read-heavy lock-free structures.
+ *
+ * Threads register once as a Participant and pin the domain around each operation instead of protecting every
+ * pointer they load, so readers pay one fence per critical section rather than one per load. Retired objects are
+ * kept in per-participant limbo lists indexed by the global epoch in which they were retired, and are freed once
+ * the epoch has advanced twice, at which point no pinned thread can still hold a reference to them.
+ *
+ * The pin fence is a lightFence(), paired with a heavyFence() whenever the epoch is advanced, so where membarrier() is
+ * available pinning costs no hardware fence at all.
+ *
+ * The trade-off against HazardDomain is that a single thread stalled while pinned blocks all reclamation.
+ */
+class EpochDomain {
+    struct Limbo {
+        Retirable* head { nullptr };
+        std::size_t count { 0 };
+        std::uint64_t epoch { 0 };
+    };
+
+    struct alignas(cacheLineSize) Record {
+        // (epoch << 1) | pinned, read by every thread that tries to advance the global epoch.
+        std::atomic<std::uint64_t> state { 0 };
+        std::atomic<bool> active { false };
+        Record* next { nullptr };
+
+        // Owned by the participant holding the record, kept apart from the shared state.
+        alignas(cacheLineSize) std::array<Limbo, 3> limbo {};
+        std::size_t retiresSinceCollect { 0 };
+    };
+
+public:
+    class Participant;
+
+    /**
+     * @brief An RAII critical section: while it exists, objects loaded from the structure will not be reclaimed.
+     */
+    class PinGuard {
+    public:
+        ~PinGuard()
+        {
+            if (m_participant != nullptr) {
+                m_participant->unpin();
+            }
+        }
+
+        PinGuard(const PinGuard&) = delete;
+        auto operator=(const PinGuard&) -> PinGuard& = delete;
+        PinGuard(PinGuard&& other) noexcept
+            : m_participant { std::exchange(other.m_participant, nullptr) }
+        {
+        }
+        auto operator=(PinGuard&&) -> PinGuard& = delete;
+
+    private:
+        friend class Participant;
+
+        explicit PinGuard(Participant* participant)
+            : m_participant { participant }
+        {
+        }
+
+        Participant* m_participant;
+    };
+
+    /**
+     * @brief A thread's registration with the domain, owning one per-thread record and its limbo lists.
+     *
+     * A participant must only be used by the thread that holds it. Pins may be nested.
+     */
+    class Participant {
+    public:
+        Participant() = default;
+        ~Participant()
+        {
+            if (m_record != nullptr) {
+                m_record->state.store(0, std::memory_order_release);
+                m_record->active.store(false, std::memory_order_release);
+            }
+        }
+
+        Participant(const Participant&) = delete;
+        auto operator=(const Participant&) -> Participant& = delete;
+        Participant(Participant&& other) noexcept
+            : m_domain { other.m_domain }
+            , m_record { std::exchange(other.m_record, nullptr) }
+            , m_pinDepth { std::exchange(other.m_pinDepth, 0) }
+        {
+        }
+        auto operator=(Participant&&) -> Participant& = delete;
+
+        /**
+         * @brief Enters a critical section.
+         *
+         * @return A guard that leaves the critical section when destroyed.
+         */
+        [[nodiscard]] auto pin() -> PinGuard
+        {
+            if (m_pinDepth++ == 0) {
+                const std::uint64_t epoch { m_domain->m_epoch.load(std::memory_order_relaxed) };
+                m_record->state.store((epoch << 1) | 1, std::memory_order_relaxed);
+                // Order the pin before any load from the structure (pairs with the heavy fence in tryAdvance()).
+                Blockbuster::lightFence();
+            }
+            return PinGuard { this };
+        }
+
+        /**
+         * @brief Checks whether the participant is inside a critical section.
+         *
+         * @return true if pinned, false otherwise.
+         */
+        [[nodiscard]] auto pinned() const -> bool
+        {
+            return m_pinDepth > 0;
+        }
+
+        /**
+         * @brief Retires an unlinked object, deferring its deletion until two epochs have passed.
+         *
+         * @tparam T The object type, which must derive from Retirable and have been allocated with new.
+         * @param object The object to retire. It must no longer be reachable by new readers.
+         */
+        template <typename T>
+        void retire(T* object)
+        {
+            static_assert(std::is_base_of_v<Retirable, T>, "Retired objects must derive from Retirable");
+
+            Retirable* const node { object };
+            node->m_deleter = &Retirable::destroy<T>;
+
+            const std::uint64_t epoch { m_domain->m_epoch.load(std::memory_order_seq_cst) };
+            Limbo& limbo { m_record->limbo[epoch % 3] };
+            if (limbo.epoch != epoch) {
+                // Anything left in this slot was retired at least three epochs ago.
+                drain(limbo);
+                limbo.epoch = epoch;
+            }
+            node->m_nextRetired = limbo.head;
+            limbo.head = node;
+            ++limbo.count;
+
+            if (++m_record->retiresSinceCollect >= m_domain->m_collectThreshold) {
+                reclaim();
+            }
+        }
+
+        /**
+         * @brief Attempts to advance the global epoch and frees every limbo list that has become safe.
+         */
+        void reclaim()
+        {
+            m_record->retiresSinceCollect = 0;
+            m_domain->tryAdvance();
+
+            const std::uint64_t epoch { m_domain->m_epoch.load(std::memory_order_acquire) };
+            for (Limbo& limbo : m_record->limbo) {
+                if (limbo.epoch + 2 <= epoch) {
+                    drain(limbo);
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of objects retired by this participant that are still awaiting reclamation.
+         *
+         * @return The number of pending objects.
+         */
+        [[nodiscard]] auto pendingCount() const -> std::size_t
+        {
+            return EpochDomain::pendingCount(*m_record);
+        }
+
+    private:
+        friend class EpochDomain;
+        friend class PinGuard;
+
+        Participant(EpochDomain* domain, Record* record)
+            : m_domain { domain }
+            , m_record { record }
+        {
+        }
+
+        void unpin()
+        {
+            if (--m_pinDepth == 0) {
+                m_record->state.store(0, std::memory_order_release);
+            }
+        }
+
+        EpochDomain* m_domain { nullptr };
+        Record* m_record { nullptr };
+        std::size_t m_pinDepth { 0 };
+    };
+
+    /**
+     * @brief Constructs an epoch-based reclamation domain.
+     *
+     * @param collectThreshold The number of retires by a participant after which it tries to reclaim.
+     */
+    explicit EpochDomain(std::size_t collectThreshold = s_defaultCollectThreshold)
+        : m_collectThreshold { std::max<std::size_t>(collectThreshold, 1) }
+    {
+    }
+
+    /**
+     * @brief Destroys the domain, reclaiming all retired objects.
+     *
+     * @note All participants must have been destroyed beforehand.
+     */
+    ~EpochDomain()
+    {
+        Record* record { m_records.load(std::memory_order_acquire) };
+        while (record != nullptr) {
+            Record* const next { record->next };
+            for (Limbo& limbo : record->limbo) {
+                drain(limbo);
+            }
+            delete record; // NOLINT(cppcoreguidelines-owning-memory)
+            record = next;
+        }
+    }
+
+    // Delete copy and move constructors to avoid complications.
+    EpochDomain(const EpochDomain&) = delete;
+    auto operator=(const EpochDomain&) -> EpochDomain& = delete;
+    EpochDomain(EpochDomain&&) = delete;
+    auto operator=(EpochDomain&&) -> EpochDomain& = delete;
+
+    /**
+     * @brief Registers the calling thread, reusing an inactive record (and its pending limbo lists) when possible.
+     *
+     * @return A participant owning the record.
+     */
+    auto makeParticipant() -> Participant
+    {
+        for (Record* record { m_records.load(std::memory_order_acquire) }; record != nullptr; record = record->next) {
+            bool expected { false };
+            if (!record->active.load(std::memory_order_relaxed)
+                && record->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return Participant { this, record };
+            }
+        }
+
+        auto* record { new Record {} }; // NOLINT(cppcoreguidelines-owning-memory)
+        record->active.store(true, std::memory_order_relaxed);
+        Record* head { m_records.load(std::memory_order_relaxed) };
+        do {
+            record->next = head;
+        } while (!m_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        return Participant { this, record };
+    }
+
+    /**
+     * @brief Advances the global epoch if every pinned participant has observed the current one.
+     *
+     * @return true if the epoch is now past the value observed on entry, false if a pinned participant lags behind.
+     */
+    auto tryAdvance() -> bool
+    {
+        std::uint64_t epoch { m_epoch.load(std::memory_order_relaxed) };
+        // Order the scan after prior unlinks and pins (pairs with the light fence in Participant::pin()).
+        Blockbuster::heavyFence();
+
+        for (Record* record { m_records.load(std::memory_order_acquire) }; record != nullptr; record = record->next) {
+            const std::uint64_t state { record->state.load(std::memory_order_relaxed) };
+            if ((state & 1) != 0 && (state >> 1) != epoch) {
+                return false;
+            }
+        }
+
+        // A failed exchange means another thread advanced the epoch, which is just as good.
+        m_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Returns the current global epoch.
+     *
+     * @return The global epoch.
+     */
+    [[nodiscard]] auto epoch() const -> std::uint64_t
+    {
+        return m_epoch.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of retired objects awaiting reclamation across all records.
+     *
+     * @return The number of retired but not yet deleted objects.
+     * @note This reads limbo lists owned by other threads and must only be called while they are quiescent.
+     */
+    [[nodiscard]] auto pendingCount() const -> std::size_t
+    {
+        std::size_t count { 0 };
+        for (Record* record { m_records.load(std::memory_order_acquire) }; record != nullptr; record = record->next) {
+            count += pendingCount(*record);
+        }
+        return count;
+    }
+
+private:
+    static constexpr std::size_t s_defaultCollectThreshold { 64 }; // NOLINT(readability-identifier-naming)
+
+    static void drain(Limbo& limbo)
+    {
+        Retirable* node { limbo.head };
+        while (node != nullptr) {
+            Retirable* const next { node->m_nextRetired };
+            node->m_deleter(node);
+            node = next;
+        }
+        limbo.head = nullptr;
+        limbo.count = 0;
+    }
+
+    static auto pendingCount(const Record& record) -> std::size_t
+    {
+        std::size_t count { 0 };
+        for (const Limbo& limbo : record.limbo) {
+            count += limbo.count;
+        }
+        return count;
+    }
+
+    std::atomic<Record*> m_records { nullptr };
+    std::size_t m_collectThreshold;
+
+    // Pad as necessary to avoid false sharing.
+    alignas(cacheLineSize) std::atomic<std::uint64_t> m_epoch { 0 };
+};
+
+/**
+ * @brief Returns the process-wide default epoch-based reclamation domain.
+ *
+ * @return The default domain.
+ */
+inline auto defaultEpochDomain() -> EpochDomain&
+{
+    static EpochDomain domain {};
+    return domain;
+}
+
+} // namespace Blockbuster::Reclamation
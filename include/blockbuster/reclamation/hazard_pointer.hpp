@@ -0,0 +1,408 @@
+#pragma once
+#include "../common.hpp"
+#include "../fence.hpp"
+#include "retirable.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Blockbuster::Reclamation {
+
+/**
+ * @brief A hazard pointer domain for safe memory reclamation in lock-free structures.
+ *
+ * Readers publish the pointer they are about to dereference in a hazard record (via a Guard), and writers hand
+ * unlinked objects to retire() instead of deleting them. Retired objects are batched in per-thread retire lists and
+ * only reclaimed by a scan once no hazard record refers to them.
+ *
+ * Hazard records are cache-line aligned, never freed before the domain, and recycled between guards, so a thread
+ * that repeatedly acquires a guard keeps reusing the same record. Each thread retires into its own cache-line-padded
+ * list, so retiring normally touches no cache line written by other threads. Scans are amortized: one is triggered only when
+ * a thread's list reaches max(scanThreshold, 2 * recordCount()) objects, and it collects every thread's list, which
+ * bounds the garbage left pending after a scan to the number of hazard records.
+ *
+ * The fence that orders a hazard publication before its validation is a lightFence(), paired with a heavyFence() in
+ * each scan, so where membarrier() is available protecting a pointer costs no hardware fence at all.
+ */
+class HazardDomain {
+    struct alignas(cacheLineSize) Record {
+        std::atomic<const void*> hazard { nullptr };
+        std::atomic<bool> active { false };
+        Record* next { nullptr };
+    };
+
+public:
+    /**
+     * @brief An RAII owner of a single hazard record.
+     *
+     * A guard protects at most one pointer at a time and must only be used by the thread that holds it.
+     */
+    class Guard {
+    public:
+        Guard() = default;
+        ~Guard()
+        {
+            if (m_record != nullptr) {
+                m_record->hazard.store(nullptr, std::memory_order_release);
+                m_record->active.store(false, std::memory_order_release);
+            }
+        }
+
+        Guard(const Guard&) = delete;
+        auto operator=(const Guard&) -> Guard& = delete;
+        Guard(Guard&& other) noexcept
+            : m_record { other.m_record }
+        {
+            other.m_record = nullptr;
+        }
+        auto operator=(Guard&& other) noexcept -> Guard&
+        {
+            if (this != &other) {
+                Guard discarded { std::move(*this) };
+                m_record = other.m_record;
+                other.m_record = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Loads a pointer from an atomic source and protects it from reclamation.
+         *
+         * @tparam T The pointee type.
+         * @param source The atomic pointer to load from.
+         * @return The protected pointer, which stays valid until the guard is cleared, reused or destroyed.
+         */
+        template <typename T>
+        auto protect(const std::atomic<T*>& source) -> T*
+        {
+            T* ptr { source.load(std::memory_order_relaxed) };
+
+            for (;;) {
+                m_record->hazard.store(address(ptr), std::memory_order_relaxed);
+                // Order the hazard publication before the validating reload (pairs with the heavy fence in reclaim()).
+                Blockbuster::lightFence();
+                T* const current { source.load(std::memory_order_acquire) };
+                if (current == ptr) {
+                    return ptr;
+                }
+                ptr = current;
+            }
+        }
+
+        /**
+         * @brief Publishes a pointer that the caller has already validated by other means.
+         *
+         * @tparam T The pointee type.
+         * @param ptr The pointer to protect.
+         */
+        template <typename T>
+        void reset(T* ptr)
+        {
+            m_record->hazard.store(address(ptr), std::memory_order_relaxed);
+            Blockbuster::lightFence();
+        }
+
+        /**
+         * @brief Stops protecting the current pointer.
+         */
+        void clear()
+        {
+            m_record->hazard.store(nullptr, std::memory_order_release);
+        }
+
+    private:
+        friend class HazardDomain;
+
+        explicit Guard(Record* record)
+            : m_record { record }
+        {
+        }
+
+        // Retired objects are identified by their Retirable base, so publish the same address for them.
+        template <typename T>
+        static auto address(T* ptr) -> const void*
+        {
+            if constexpr (std::is_base_of_v<Retirable, T>) {
+                return static_cast<const Retirable*>(ptr);
+            } else {
+                return ptr;
+            }
+        }
+
+        Record* m_record { nullptr };
+    };
+
+    /**
+     * @brief Constructs a hazard pointer domain.
+     *
+     * @param scanThreshold The minimum number of objects in a thread's retire list that triggers a reclamation scan.
+     */
+    explicit HazardDomain(std::size_t scanThreshold = s_defaultScanThreshold)
+        : m_scanThreshold { std::max<std::size_t>(scanThreshold, 1) }
+    {
+    }
+
+    /**
+     * @brief Destroys the domain, reclaiming all retired objects.
+     *
+     * @note All guards must have been destroyed beforehand.
+     */
+    ~HazardDomain()
+    {
+        destroyAll(m_retired.exchange(nullptr, std::memory_order_acquire));
+        for (RetireList& list : m_retireLists) {
+            destroyAll(list.head.exchange(nullptr, std::memory_order_acquire));
+        }
+
+        Record* record { m_records.load(std::memory_order_acquire) };
+        while (record != nullptr) {
+            Record* const next { record->next };
+            delete record; // NOLINT(cppcoreguidelines-owning-memory)
+            record = next;
+        }
+    }
+
+    // Delete copy and move constructors to avoid complications.
+    HazardDomain(const HazardDomain&) = delete;
+    auto operator=(const HazardDomain&) -> HazardDomain& = delete;
+    HazardDomain(HazardDomain&&) = delete;
+    auto operator=(HazardDomain&&) -> HazardDomain& = delete;
+
+    /**
+     * @brief Acquires a hazard record, reusing an inactive one when possible.
+     *
+     * @return A guard owning the record.
+     * @note Acquisition walks the record list, so guards are best kept for the lifetime of a thread's operation.
+     */
+    auto makeGuard() -> Guard
+    {
+        for (Record* record { m_records.load(std::memory_order_acquire) }; record != nullptr; record = record->next) {
+            bool expected { false };
+            if (!record->active.load(std::memory_order_relaxed)
+                && record->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return Guard { record };
+            }
+        }
+
+        auto* record { new Record {} }; // NOLINT(cppcoreguidelines-owning-memory)
+        record->active.store(true, std::memory_order_relaxed);
+        Record* head { m_records.load(std::memory_order_relaxed) };
+        do {
+            record->next = head;
+        } while (!m_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        m_recordCount.fetch_add(1, std::memory_order_relaxed);
+        return Guard { record };
+    }
+
+    /**
+     * @brief Retires an unlinked object, deferring its deletion until no guard protects it.
+     *
+     * @tparam T The object type, which must derive from Retirable and have been allocated with new.
+     * @param object The object to retire. It must no longer be reachable by new readers.
+     */
+    template <typename T>
+    void retire(T* object)
+    {
+        static_assert(std::is_base_of_v<Retirable, T>, "Retired objects must derive from Retirable");
+
+        Retirable* const node { object };
+        node->m_deleter = &Retirable::destroy<T>;
+
+        RetireList& list { m_retireLists[Detail::threadIndex() & (s_retireListCount - 1)] };
+        Retirable* head { list.head.load(std::memory_order_relaxed) };
+        do {
+            node->m_nextRetired = head;
+        } while (!list.head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+        if (list.count.fetch_add(1, std::memory_order_relaxed) + 1 >= scanThreshold()) {
+            reclaim();
+        }
+    }
+
+    /**
+     * @brief Scans the hazard records and deletes every retired object that is not protected.
+     */
+    void reclaim()
+    {
+        // Collect the survivors of earlier scans and every thread's retire list into one chain.
+        Retirable* node { m_retired.exchange(nullptr, std::memory_order_acquire) };
+        m_retiredCount.fetch_sub(length(node), std::memory_order_relaxed);
+        for (RetireList& list : m_retireLists) {
+            Retirable* const head { list.head.exchange(nullptr, std::memory_order_acquire) };
+            if (head == nullptr) {
+                continue;
+            }
+            std::size_t taken { 1 };
+            Retirable* tail { head };
+            for (; tail->m_nextRetired != nullptr; tail = tail->m_nextRetired) {
+                ++taken;
+            }
+            tail->m_nextRetired = node;
+            node = head;
+            list.count.fetch_sub(taken, std::memory_order_relaxed);
+        }
+        if (node == nullptr) {
+            return;
+        }
+
+        // Pairs with the light fence in Guard::protect(): any hazard published before the object was unlinked is visible.
+        Blockbuster::heavyFence();
+
+        std::vector<const void*> hazards {};
+        hazards.reserve(m_recordCount.load(std::memory_order_relaxed));
+        for (Record* record { m_records.load(std::memory_order_acquire) }; record != nullptr; record = record->next) {
+            const void* const hazard { record->hazard.load(std::memory_order_acquire) };
+            if (hazard != nullptr) {
+                hazards.push_back(hazard);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        Retirable* keptHead { nullptr };
+        Retirable* keptTail { nullptr };
+        std::size_t kept { 0 };
+
+        while (node != nullptr) {
+            Retirable* const next { node->m_nextRetired };
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(node))) {
+                node->m_nextRetired = keptHead;
+                keptHead = node;
+                if (keptTail == nullptr) {
+                    keptTail = node;
+                }
+                ++kept;
+            } else {
+                node->m_deleter(node);
+            }
+            node = next;
+        }
+
+        if (keptHead != nullptr) {
+            m_retiredCount.fetch_add(kept, std::memory_order_relaxed);
+            push(keptHead, keptTail);
+        }
+    }
+
+    /**
+     * @brief Returns the number of retired objects awaiting reclamation.
+     *
+     * @return The number of retired but not yet deleted objects.
+     * @note This may return incorrect results under concurrent access and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto retiredCount() const -> std::size_t
+    {
+        std::size_t count { m_retiredCount.load(std::memory_order_relaxed) };
+        for (const RetireList& list : m_retireLists) {
+            count += list.count.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of hazard records allocated by the domain.
+     *
+     * @return The number of hazard records, which equals the peak number of simultaneously held guards.
+     */
+    [[nodiscard]] auto recordCount() const -> std::size_t
+    {
+        return m_recordCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of objects in a thread's retire list that triggers a scan.
+     *
+     * @return max(scanThreshold, 2 * recordCount()).
+     */
+    [[nodiscard]] auto scanThreshold() const -> std::size_t
+    {
+        return std::max(m_scanThreshold, 2 * recordCount());
+    }
+
+    /**
+     * @brief Returns the bound on pending garbage when retires are not racing with a scan.
+     *
+     * Each of the retireListCount() lists holds fewer than scanThreshold() objects between scans, and a scan leaves at
+     * most one protected object per hazard record behind.
+     *
+     * @return retireListCount() * (scanThreshold() - 1) + recordCount().
+     */
+    [[nodiscard]] auto garbageBound() const -> std::size_t
+    {
+        return retireListCount() * (scanThreshold() - 1) + recordCount();
+    }
+
+    /**
+     * @brief Returns the number of per-thread retire lists.
+     *
+     * @return The number of lists. Threads beyond this share lists, which stays correct but brings back some contention.
+     */
+    [[nodiscard]] static constexpr auto retireListCount() -> std::size_t
+    {
+        return s_retireListCount;
+    }
+
+private:
+    static constexpr std::size_t s_defaultScanThreshold { 64 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::size_t s_retireListCount { 16 }; // NOLINT(readability-identifier-naming)
+
+    // Pad as necessary to avoid false sharing.
+    struct alignas(cacheLineSize) RetireList {
+        std::atomic<Retirable*> head { nullptr };
+        std::atomic<std::size_t> count { 0 };
+    };
+
+    static auto length(const Retirable* node) -> std::size_t
+    {
+        std::size_t count { 0 };
+        for (; node != nullptr; node = node->m_nextRetired) {
+            ++count;
+        }
+        return count;
+    }
+
+    static void destroyAll(Retirable* node)
+    {
+        while (node != nullptr) {
+            Retirable* const next { node->m_nextRetired };
+            node->m_deleter(node);
+            node = next;
+        }
+    }
+
+    // Splices the chain [first, last] onto the list of objects that survived a scan.
+    void push(Retirable* first, Retirable* last)
+    {
+        Retirable* head { m_retired.load(std::memory_order_relaxed) };
+        do {
+            last->m_nextRetired = head;
+        } while (!m_retired.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    std::atomic<Record*> m_records { nullptr };
+    std::atomic<std::size_t> m_recordCount { 0 };
+    std::size_t m_scanThreshold;
+
+    // Pad as necessary to avoid false sharing.
+    std::array<RetireList, s_retireListCount> m_retireLists {};
+
+    // Objects kept by a scan because they were protected, only touched by scans.
+    alignas(cacheLineSize) std::atomic<Retirable*> m_retired { nullptr };
+    std::atomic<std::size_t> m_retiredCount { 0 };
+};
+
+/**
+ * @brief Returns the process-wide default hazard pointer domain.
+ *
+ * @return The default domain.
+ */
+inline auto defaultHazardDomain() -> HazardDomain&
+{
+    static HazardDomain domain {};
+    return domain;
+}
+
+} // namespace Blockbuster::Reclamation
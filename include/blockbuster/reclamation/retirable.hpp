@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Blockbuster::Reclamation {
+
+class EpochDomain;
+class HazardDomain;
+
+/**
+ * @brief Intrusive base for objects whose destruction is deferred by a reclamation domain.
+ *
+ * Nodes of lock-free structures derive from this so that retiring an object never allocates: the domain links
+ * retired objects together through the embedded pointer and destroys them once no reader can still observe them.
+ */
+class Retirable {
+protected:
+    Retirable() = default;
+    ~Retirable() = default;
+
+public:
+    Retirable(const Retirable&) = delete;
+    auto operator=(const Retirable&) -> Retirable& = delete;
+    Retirable(Retirable&&) = delete;
+    auto operator=(Retirable&&) -> Retirable& = delete;
+
+private:
+    friend class EpochDomain;
+    friend class HazardDomain;
+
+    template <typename T>
+    static void destroy(Retirable* object)
+    {
+        delete static_cast<T*>(object); // NOLINT(cppcoreguidelines-owning-memory)
+    }
+
+    Retirable* m_nextRetired { nullptr };
+    void (*m_deleter)(Retirable*) { nullptr };
+};
+
+} // namespace Blockbuster::Reclamation
@@ -0,0 +1,128 @@
+#pragma once
+#include "event_count.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Blockbuster {
+
+/**
+ * @brief The order in which a Selector checks its queues.
+ */
+enum class SelectPolicy : std::uint8_t {
+    // Start after the queue served last, so a busy queue cannot starve the others.
+    roundRobin,
+    // Always start at the queue added first, so earlier queues take precedence.
+    priority
+};
+
+/**
+ * @brief Waits on several queues at once and takes from whichever is ready, like Go's select.
+ *
+ * The selecting thread is the consumer of every queue it watches. When all of them are empty, select() parks the
+ * thread on an EventCount instead of spinning, so one thread can multiplex many input rings without burning CPU.
+ * Producers call notify() after each enqueue to wake it, which costs a light fence and a relaxed load while the
+ * consumer is not parked.
+ *
+ * @tparam Queue The queue type, e.g. Spsc::Queue<T, Capacity>. Must provide dequeue() returning std::optional.
+ * @note Queues must outlive the selector. Only one thread may select at a time.
+ */
+template <typename Queue>
+class Selector {
+public:
+    using Item = typename decltype(std::declval<Queue&>().dequeue())::value_type;
+
+    /**
+     * @brief Constructs a selector with no queues.
+     *
+     * @param policy The order in which queues are checked.
+     */
+    explicit Selector(SelectPolicy policy = SelectPolicy::roundRobin)
+        : m_policy { policy }
+    {
+    }
+
+    ~Selector() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    Selector(const Selector&) = delete;
+    auto operator=(const Selector&) -> Selector& = delete;
+    Selector(Selector&&) = delete;
+    auto operator=(Selector&&) -> Selector& = delete;
+
+    /**
+     * @brief Adds a queue to watch. Must not be called while another thread selects.
+     *
+     * @param queue The queue, which must be fed by producers that call notify().
+     * @return The index that identifies the queue in selection results.
+     */
+    auto add(Queue& queue) -> std::size_t
+    {
+        m_queues.push_back(&queue);
+        return m_queues.size() - 1;
+    }
+
+    /**
+     * @brief Takes an item from the first ready queue without waiting.
+     *
+     * @return An optional containing the queue's index and the item, or std::nullopt if every queue was empty.
+     */
+    auto trySelect() -> std::optional<std::pair<std::size_t, Item>>
+    {
+        const std::size_t count { m_queues.size() };
+        const std::size_t start { m_policy == SelectPolicy::roundRobin ? m_next : 0 };
+
+        for (std::size_t offset { 0 }; offset < count; ++offset) {
+            std::size_t index { start + offset };
+            index = index < count ? index : index - count;
+            if (std::optional<Item> item { m_queues[index]->dequeue() }) {
+                m_next = index + 1 < count ? index + 1 : 0;
+                return std::pair<std::size_t, Item> { index, std::move(*item) };
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Takes an item from the first ready queue, parking the thread while every queue is empty.
+     *
+     * @return The queue's index and the item.
+     */
+    auto select() -> std::pair<std::size_t, Item>
+    {
+        std::optional<std::pair<std::size_t, Item>> selected {};
+        m_events.wait([this, &selected]() {
+            selected = trySelect();
+            return selected.has_value();
+        });
+        return std::move(*selected);
+    }
+
+    /**
+     * @brief Wakes the selecting thread if it is parked. Must be called after each enqueue (producers).
+     */
+    void notify()
+    {
+        m_events.notify();
+    }
+
+    /**
+     * @brief Returns the number of queues watched.
+     *
+     * @return The number of queues.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_queues.size();
+    }
+
+private:
+    std::vector<Queue*> m_queues {};
+    SelectPolicy m_policy;
+    std::size_t m_next { 0 };
+    EventCount m_events {};
+};
+
+} // namespace Blockbuster
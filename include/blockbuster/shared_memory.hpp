@@ -0,0 +1,321 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fcntl.h>
+#include <optional>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace Blockbuster {
+
+namespace Detail {
+
+    inline pid_t cachedPid { 0 };
+
+    // Cached so that hot paths can stamp ownership without a system call, and refreshed in the child after fork().
+    inline auto currentPid() -> pid_t
+    {
+        static const bool registered { [] {
+            cachedPid = ::getpid();
+            return ::pthread_atfork(nullptr, nullptr, [] { cachedPid = ::getpid(); }) == 0;
+        }() };
+        static_cast<void>(registered);
+        return cachedPid;
+    }
+
+} // namespace Detail
+
+/**
+ * @brief An owned mapping of a POSIX shared memory object.
+ *
+ * The object is either named (shm_open()) so that unrelated processes can open it, anonymous (memfd_create()) so
+ * that it can be inherited across fork() or passed on as a file descriptor, or a regular file when the contents must
+ * persist. Freshly created memory is zero-filled.
+ */
+class SharedMemory {
+public:
+    /**
+     * @brief Creates and maps a named shared memory object.
+     *
+     * @param name The object name (e.g. "/orders"). Creation fails if it already exists.
+     * @param size The size of the object in bytes.
+     * @return The mapping, or std::nullopt if the object could not be created or mapped.
+     */
+    static auto create(const char* name, std::size_t size) -> std::optional<SharedMemory>
+    {
+        const int fd { ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name);
+            return std::nullopt;
+        }
+        std::optional<SharedMemory> memory { map(fd, size) };
+        if (!memory) {
+            ::shm_unlink(name);
+        }
+        return memory;
+    }
+
+    /**
+     * @brief Creates and maps an anonymous shared memory object.
+     *
+     * @param size The size of the object in bytes.
+     * @return The mapping, or std::nullopt if the object could not be created or mapped.
+     */
+    static auto createAnonymous(std::size_t size) -> std::optional<SharedMemory>
+    {
+        const int fd { ::memfd_create("blockbuster", MFD_CLOEXEC) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        return map(fd, size);
+    }
+
+    /**
+     * @brief Creates and maps a regular file, e.g. to persist the contents.
+     *
+     * @param path The file path. Creation fails if the file already exists.
+     * @param size The size of the file in bytes.
+     * @return The mapping, or std::nullopt if the file could not be created or mapped.
+     */
+    static auto createFile(const char* path, std::size_t size) -> std::optional<SharedMemory>
+    {
+        const int fd { ::open(path, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::unlink(path);
+            return std::nullopt;
+        }
+        std::optional<SharedMemory> memory { map(fd, size) };
+        if (!memory) {
+            ::unlink(path);
+        }
+        return memory;
+    }
+
+    /**
+     * @brief Creates and maps an unnamed file that is removed when the mapping is closed.
+     *
+     * Unlike createAnonymous(), the contents are backed by the file system rather than memory, so they can grow beyond
+     * available memory without swap.
+     *
+     * @param directory The directory to create the file in. Its file system must support O_TMPFILE.
+     * @param size The size of the file in bytes.
+     * @return The mapping, or std::nullopt if the file could not be created or mapped.
+     */
+    static auto createTemporaryFile(const char* directory, std::size_t size) -> std::optional<SharedMemory>
+    {
+        const int fd { ::open(directory, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        return map(fd, size);
+    }
+
+    /**
+     * @brief Opens and maps an existing regular file.
+     *
+     * @param path The file path.
+     * @param size The expected size of the file in bytes.
+     * @return The mapping, or std::nullopt if the file does not exist, has a different size, or could not be mapped.
+     */
+    static auto openFile(const char* path, std::size_t size) -> std::optional<SharedMemory>
+    {
+        const int fd { ::open(path, O_RDWR | O_CLOEXEC) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        return open(fd, size);
+    }
+
+    /**
+     * @brief Opens and maps an existing named shared memory object.
+     *
+     * @param name The object name passed to create().
+     * @param size The expected size of the object in bytes.
+     * @return The mapping, or std::nullopt if the object does not exist, has a different size, or could not be mapped.
+     */
+    static auto open(const char* name, std::size_t size) -> std::optional<SharedMemory>
+    {
+        const int fd { ::shm_open(name, O_RDWR, 0) };
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        return open(fd, size);
+    }
+
+    /**
+     * @brief Maps an existing shared memory object through a file descriptor.
+     *
+     * @param fd A file descriptor referring to the object. The mapping takes ownership of it.
+     * @param size The expected size of the object in bytes.
+     * @return The mapping, or std::nullopt if the object has a different size or could not be mapped.
+     */
+    static auto open(int fd, std::size_t size) -> std::optional<SharedMemory>
+    {
+        struct stat info { };
+        if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) != size) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        return map(fd, size);
+    }
+
+    /**
+     * @brief Removes a named shared memory object; existing mappings stay valid until they are closed.
+     *
+     * @param name The object name passed to create().
+     * @return true if the name was removed, false otherwise.
+     */
+    static auto unlink(const char* name) -> bool
+    {
+        return ::shm_unlink(name) == 0;
+    }
+
+    ~SharedMemory()
+    {
+        if (m_data != nullptr) {
+            ::munmap(m_data, m_size);
+            ::close(m_fd);
+        }
+    }
+
+    SharedMemory(const SharedMemory&) = delete;
+    auto operator=(const SharedMemory&) -> SharedMemory& = delete;
+    SharedMemory(SharedMemory&& other) noexcept
+        : m_fd { std::exchange(other.m_fd, -1) }
+        , m_data { std::exchange(other.m_data, nullptr) }
+        , m_size { std::exchange(other.m_size, 0) }
+    {
+    }
+    // The previous mapping is handed to the other object, which releases it.
+    auto operator=(SharedMemory&& other) noexcept -> SharedMemory&
+    {
+        std::swap(m_fd, other.m_fd);
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the start of the mapping.
+     *
+     * @return A pointer to the mapped memory.
+     */
+    [[nodiscard]] auto data() const -> void*
+    {
+        return m_data;
+    }
+
+    /**
+     * @brief Returns the size of the mapping.
+     *
+     * @return The size in bytes.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Returns the file descriptor backing the mapping, e.g. to pass an anonymous object to another process.
+     *
+     * @return The file descriptor.
+     */
+    [[nodiscard]] auto fd() const -> int
+    {
+        return m_fd;
+    }
+
+    /**
+     * @brief Writes modified pages back to the backing file and waits for completion.
+     *
+     * @return true if the pages were written, false otherwise.
+     */
+    auto sync() -> bool
+    {
+        return ::msync(m_data, m_size, MS_SYNC) == 0;
+    }
+
+private:
+    SharedMemory(int fd, void* data, std::size_t size)
+        : m_fd { fd }
+        , m_data { data }
+        , m_size { size }
+    {
+    }
+
+    static auto map(int fd, std::size_t size) -> std::optional<SharedMemory>
+    {
+        void* data { ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) };
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        return SharedMemory { fd, data, size };
+    }
+
+    int m_fd;
+    void* m_data;
+    std::size_t m_size;
+};
+
+/**
+ * @brief The versioned header at the start of every shared memory layout.
+ *
+ * The creator fills in the header last and publishes it with a release store, so a process that attaches early sees
+ * either an unready header or a fully initialised layout. Processes built with a different element type, capacity or
+ * layout version are rejected instead of corrupting each other.
+ */
+struct SharedHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t elementSize;
+    std::uint64_t capacity;
+    std::atomic<std::uint32_t> ready;
+
+    /**
+     * @brief Initialises and publishes the header (creator only).
+     */
+    void publish(std::uint64_t layoutMagic, std::uint32_t layoutVersion, std::size_t layoutElementSize,
+        std::size_t layoutCapacity)
+    {
+        magic = layoutMagic;
+        version = layoutVersion;
+        elementSize = static_cast<std::uint32_t>(layoutElementSize);
+        capacity = layoutCapacity;
+        ready.store(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Checks that the header is published and describes the expected layout.
+     *
+     * @return true if the layout is compatible, false otherwise.
+     */
+    [[nodiscard]] auto matches(std::uint64_t layoutMagic, std::uint32_t layoutVersion, std::size_t layoutElementSize,
+        std::size_t layoutCapacity) const -> bool
+    {
+        return ready.load(std::memory_order_acquire) != 0 && magic == layoutMagic && version == layoutVersion
+            && elementSize == layoutElementSize && capacity == layoutCapacity;
+    }
+};
+
+} // namespace Blockbuster
@@ -0,0 +1,194 @@
+#pragma once
+#include "../common.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace Blockbuster::Spmc {
+
+/**
+ * @brief A lossy Single-Producer Multi-Consumer (SPMC) ring that overwrites its oldest entries.
+ *
+ * The producer never blocks or fails: once the ring is full, each push() overwrites the oldest entry. Every reader
+ * has its own cursor and sees every entry that has not been overwritten by the time it gets to it. As in Mpmc::Queue,
+ * each slot carries a sequence number, here used as a per-slot seqlock: a reader compares the sequence before and
+ * after copying an entry, and detects that it was lapped when the sequence belongs to a later pass over the ring. A
+ * lapped reader skips ahead to the oldest entry still available and counts what it missed.
+ *
+ * @tparam T The type of elements stored in the ring. Must be trivially copyable.
+ * @tparam Capacity The number of entries retained. Must be a power of 2.
+ * @note Readers copy entries optimistically while the producer may be overwriting them; torn copies are detected and
+ * discarded, never returned.
+ */
+template <typename T, std::size_t Capacity>
+class OverwriteRing {
+public:
+    /**
+     * @brief An independent read cursor. A reader must only be used by one thread at a time.
+     */
+    class Reader {
+    public:
+        /**
+         * @brief Returns the next entry, skipping any that were overwritten before they could be read.
+         *
+         * @return An optional containing the entry, or std::nullopt if the reader has caught up with the producer.
+         */
+        auto read() -> std::optional<T>
+        {
+            for (;;) {
+                Slot& slot { m_ring->m_buffer[m_ring->wrap(m_position)] };
+                const std::uint64_t expected { published(m_position) };
+                const std::uint64_t before { slot.sequence.load(std::memory_order_acquire) };
+
+                if (before < expected) {
+                    return std::nullopt;
+                }
+                if (before == expected) {
+                    const T item { slot.data };
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                        ++m_position;
+                        return item;
+                    }
+                }
+                skipLapped();
+            }
+        }
+
+        /**
+         * @brief Moves the cursor past every entry pushed so far, without counting them as dropped.
+         */
+        void skipToEnd()
+        {
+            m_position = m_ring->m_writePos.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Returns the number of entries this reader missed because they were overwritten first.
+         *
+         * @return The number of dropped entries.
+         */
+        [[nodiscard]] auto droppedCount() const -> std::uint64_t
+        {
+            return m_dropped;
+        }
+
+    private:
+        friend class OverwriteRing;
+
+        Reader(OverwriteRing& ring, std::uint64_t position)
+            : m_ring { &ring }
+            , m_position { position }
+        {
+        }
+
+        // Resume at the oldest entry still retained; if that is overwritten in turn, the next read skips again.
+        void skipLapped()
+        {
+            const std::uint64_t next { std::max(m_ring->oldestPosition(), m_position + 1) };
+            m_dropped += next - m_position;
+            m_position = next;
+        }
+
+        OverwriteRing* m_ring;
+        std::uint64_t m_position;
+        std::uint64_t m_dropped { 0 };
+    };
+
+    OverwriteRing() = default;
+    ~OverwriteRing() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    OverwriteRing(const OverwriteRing&) = delete;
+    auto operator=(const OverwriteRing&) -> OverwriteRing& = delete;
+    OverwriteRing(OverwriteRing&&) = delete;
+    auto operator=(OverwriteRing&&) -> OverwriteRing& = delete;
+
+    /**
+     * @brief Pushes an entry, overwriting the oldest one if the ring is full (producer only).
+     *
+     * @param item The entry to push.
+     */
+    void push(const T& item)
+    {
+        const std::uint64_t position { m_writePos.load(std::memory_order_relaxed) };
+        Slot& slot { m_buffer[wrap(position)] };
+
+        // An odd sequence marks the slot as being written, so readers of the previous entry see it change.
+        slot.sequence.store(published(position) - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.data = item;
+        slot.sequence.store(published(position), std::memory_order_release);
+        m_writePos.store(position + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Creates a reader positioned at the oldest entry still retained.
+     *
+     * @return The reader.
+     * @note The ring must outlive the reader.
+     */
+    auto makeReader() -> Reader
+    {
+        return Reader { *this, oldestPosition() };
+    }
+
+    /**
+     * @brief Returns the total number of entries pushed.
+     *
+     * @return The number of pushed entries.
+     * @note The return value may be immediately outdated and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto pushedCount() const -> std::uint64_t
+    {
+        return m_writePos.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the capacity of the ring.
+     *
+     * @return The number of entries retained.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return Capacity;
+    }
+
+private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be greater than 0 and a power of 2");
+    static_assert(std::is_trivially_copyable_v<T>, "Entries must be trivially copyable to be read optimistically");
+
+    // A sequence of 2 * (position + 1) marks a slot holding the entry at that position; 0 marks an unused slot.
+    struct Slot {
+        std::atomic<std::uint64_t> sequence { 0 };
+        T data {};
+    };
+
+    [[nodiscard]] static constexpr auto published(std::uint64_t position) -> std::uint64_t
+    {
+        return 2 * (position + 1);
+    }
+
+    [[nodiscard]] auto oldestPosition() const -> std::uint64_t
+    {
+        const std::uint64_t written { m_writePos.load(std::memory_order_acquire) };
+        return written > Capacity ? written - Capacity : 0;
+    }
+
+    // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
+    [[nodiscard]] auto wrap(std::uint64_t index) const -> std::size_t
+    {
+        return static_cast<std::size_t>(index & (Capacity - 1));
+    }
+
+    std::array<Slot, Capacity> m_buffer {};
+
+    // Pad as necessary to avoid false sharing.
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::uint64_t> m_writePos { 0 };
+};
+
+} // namespace Blockbuster::Spmc
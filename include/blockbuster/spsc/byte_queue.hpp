@@ -0,0 +1,233 @@
+#pragma once
+#include "../common.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+namespace Blockbuster::Spsc {
+
+/**
+ * @brief A wait-free Single-Producer Single-Consumer (SPSC) queue of variable-length byte records.
+ *
+ * Records are stored contiguously with an 8-byte length prefix and are padded only to 8-byte alignment, so the
+ * producer can build a record in place with reserve()/commit() and the consumer can parse it in place with
+ * read()/release(). As in a bip-buffer, a record never straddles the end of the buffer: when it does not fit in the
+ * remaining space, that space is skipped with a padding marker and the record starts again at the beginning.
+ *
+ * @tparam Capacity The size of the buffer in bytes. Must be a power of 2 and at least 16.
+ * @note A single record can hold at most (Capacity / 2 - 8) bytes, so that it fits regardless of the wrap point.
+ */
+template <std::size_t Capacity>
+class ByteQueue {
+public:
+    /**
+     * @brief A view of a record's payload inside the buffer.
+     */
+    struct Record {
+        const std::byte* data;
+        std::size_t size;
+    };
+
+    ByteQueue() = default;
+    ~ByteQueue() = default;
+
+    // Delete copy and move constructors to avoid complications.
+    ByteQueue(const ByteQueue&) = delete;
+    auto operator=(const ByteQueue&) -> ByteQueue& = delete;
+    ByteQueue(ByteQueue&&) = delete;
+    auto operator=(ByteQueue&&) -> ByteQueue& = delete;
+
+    /**
+     * @brief Reserves contiguous space for a record (producer only).
+     *
+     * @param size The maximum payload size the caller intends to write.
+     * @return A pointer to at least size writable bytes, or nullptr if there is not enough free space.
+     * @note Each successful reserve() must be followed by a commit() before the next reserve().
+     */
+    auto reserve(std::size_t size) -> std::byte*
+    {
+        if (size > maxRecordSize()) {
+            return nullptr;
+        }
+
+        const std::size_t stride { strideOf(size) };
+        const std::size_t tail { m_tail.load(std::memory_order_relaxed) };
+        const std::size_t contiguous { s_capacity - wrap(tail) };
+        const std::size_t padding { stride <= contiguous ? 0 : contiguous };
+
+        if (!hasSpace(tail, padding + stride)) {
+            return nullptr;
+        }
+
+        m_pendingPadding = padding;
+        return &m_buffer[wrap(tail + padding) + s_headerSize];
+    }
+
+    /**
+     * @brief Publishes the record previously reserved (producer only).
+     *
+     * @param size The number of bytes actually written, which must not exceed the reserved size.
+     */
+    void commit(std::size_t size)
+    {
+        const std::size_t tail { m_tail.load(std::memory_order_relaxed) };
+        if (m_pendingPadding != 0) {
+            writeHeader(wrap(tail), s_paddingMarker);
+        }
+        writeHeader(wrap(tail + m_pendingPadding), static_cast<std::uint64_t>(size));
+        m_tail.store(tail + m_pendingPadding + strideOf(size), std::memory_order_release);
+        m_pendingPadding = 0;
+    }
+
+    /**
+     * @brief Copies a record into the queue.
+     *
+     * @param data The payload to copy.
+     * @param size The payload size in bytes.
+     * @return true if the record was successfully enqueued, false if the queue was full.
+     */
+    auto enqueue(const void* data, std::size_t size) -> bool
+    {
+        std::byte* const destination { reserve(size) };
+        if (destination == nullptr) {
+            return false;
+        }
+        std::memcpy(destination, data, size);
+        commit(size);
+        return true;
+    }
+
+    /**
+     * @brief Returns the oldest record without removing it (consumer only).
+     *
+     * @return A view of the record, valid until release(), or std::nullopt if the queue was empty.
+     */
+    auto read() -> std::optional<Record>
+    {
+        std::size_t head { m_head.load(std::memory_order_relaxed) };
+        if (head == m_tailCache) {
+            m_tailCache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tailCache) {
+                return std::nullopt;
+            }
+        }
+
+        std::uint64_t size { readHeader(wrap(head)) };
+        if (size == s_paddingMarker) {
+            // The producer always commits the padding together with the record that follows it.
+            head += s_capacity - wrap(head);
+            m_head.store(head, std::memory_order_release);
+            size = readHeader(wrap(head));
+        }
+
+        m_readStride = strideOf(static_cast<std::size_t>(size));
+        return Record { &m_buffer[wrap(head) + s_headerSize], static_cast<std::size_t>(size) };
+    }
+
+    /**
+     * @brief Removes the record returned by the last read(), freeing its space (consumer only).
+     */
+    void release()
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + m_readStride, std::memory_order_release);
+        m_readStride = 0;
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note The return value may be immediately outdated and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of buffer bytes in use, including headers and padding.
+     *
+     * @return The number of used bytes.
+     * @note The return value may be immediately outdated and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto usedBytes() const -> std::size_t
+    {
+        return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the capacity of the buffer.
+     *
+     * @return The size of the buffer in bytes.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return s_capacity;
+    }
+
+    /**
+     * @brief Returns the largest payload a single record can hold.
+     *
+     * @return The maximum record size in bytes.
+     */
+    [[nodiscard]] static constexpr auto maxRecordSize() -> std::size_t
+    {
+        return s_capacity / 2 - s_headerSize;
+    }
+
+private:
+    static constexpr std::size_t s_capacity { Capacity }; // NOLINT(readability-identifier-naming)
+    static_assert(s_capacity >= 16 && (s_capacity & (s_capacity - 1)) == 0, "Capacity must be at least 16 and a power of 2");
+
+    static constexpr std::size_t s_headerSize { 8 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint64_t s_paddingMarker { ~std::uint64_t { 0 } }; // NOLINT(readability-identifier-naming)
+
+    // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
+    [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
+    {
+        return index & (s_capacity - 1);
+    }
+
+    // Header plus payload, rounded up so that every header stays 8-byte aligned.
+    [[nodiscard]] static constexpr auto strideOf(std::size_t size) -> std::size_t
+    {
+        return (s_headerSize + size + s_headerSize - 1) & ~(s_headerSize - 1);
+    }
+
+    auto hasSpace(std::size_t tail, std::size_t bytes) -> bool
+    {
+        if (tail + bytes - m_headCache <= s_capacity) {
+            return true;
+        }
+        m_headCache = m_head.load(std::memory_order_acquire);
+        return tail + bytes - m_headCache <= s_capacity;
+    }
+
+    void writeHeader(std::size_t offset, std::uint64_t value)
+    {
+        std::memcpy(&m_buffer[offset], &value, sizeof(value));
+    }
+
+    [[nodiscard]] auto readHeader(std::size_t offset) const -> std::uint64_t
+    {
+        std::uint64_t value {};
+        std::memcpy(&value, &m_buffer[offset], sizeof(value));
+        return value;
+    }
+
+    alignas(s_headerSize) std::array<std::byte, s_capacity> m_buffer {};
+
+    // Pad as necessary to avoid false sharing. Each side caches the other's index to avoid needless cache misses.
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> m_tail { 0 };
+    std::size_t m_headCache { 0 };
+    std::size_t m_pendingPadding { 0 };
+
+    alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> m_head { 0 };
+    std::size_t m_tailCache { 0 };
+    std::size_t m_readStride { 0 };
+};
+
+} // namespace Blockbuster::Spsc
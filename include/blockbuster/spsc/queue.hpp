@@ -1,4 +1,6 @@
 #pragma once
+#include "../stats_policy.hpp"
+#include "../trace/trace_point.hpp"
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -16,10 +18,12 @@ constexpr std::size_t cacheLineSize { 64 };
  *
  * @tparam T The type of elements stored in the queue.
  * @tparam Capacity The maximum number of elements the queue should hold. Must be a power of 2.
+ * @tparam Stats The statistics policy. NoStats (the default) compiles away; QueueStats counts operation outcomes, and
+ * LatencyStats also measures how long elements spend in the queue. Both are declared in stats.hpp.
  * @note The actual capacity is (Capacity - 1) due to implementation specifics.
  */
-template <typename T, std::size_t Capacity>
-class Queue {
+template <typename T, std::size_t Capacity, typename Stats = NoStats>
+class Queue : private Stats {
 public:
     Queue() = default;
     ~Queue() = default;
@@ -42,13 +46,19 @@ public:
     {
         const std::size_t currTail { m_tail.load(std::memory_order_relaxed) };
         const std::size_t nextTail { wrap(currTail + 1) };
+        const std::size_t currHead { m_head.load(std::memory_order_relaxed) };
 
-        if (nextTail == m_head.load(std::memory_order_relaxed)) {
+        if (nextTail == currHead) {
+            Stats::onEnqueueFull();
+            BLOCKBUSTER_TRACE(enqueueFull, this, currTail);
             return false;
         }
 
         m_buffer[currTail] = std::forward<U>(item);
+        Stats::onWrite(currTail);
         m_tail.store(nextTail, std::memory_order_release);
+        Stats::onEnqueue(wrap(nextTail - currHead));
+        BLOCKBUSTER_TRACE(enqueue, this, currTail);
         return true;
     }
 
@@ -62,11 +72,16 @@ public:
         const std::size_t currHead { m_head.load(std::memory_order_relaxed) };
 
         if (currHead == m_tail.load(std::memory_order_acquire)) {
+            Stats::onDequeueEmpty();
+            BLOCKBUSTER_TRACE(dequeueEmpty, this, currHead);
             return std::nullopt;
         }
 
         const T item { std::move(m_buffer[currHead]) };
+        Stats::onRead(currHead);
         m_head.store(wrap(currHead + 1), std::memory_order_release);
+        Stats::onDequeue();
+        BLOCKBUSTER_TRACE(dequeue, this, currHead);
         return item;
     }
 
@@ -113,9 +128,20 @@ public:
         return wrap(m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed));
     }
 
+    /**
+     * @brief Returns the statistics recorded by the Stats policy.
+     *
+     * @return The statistics policy, e.g. to call snapshot() on.
+     */
+    [[nodiscard]] auto stats() const -> const Stats&
+    {
+        return *this;
+    }
+
 private:
     static constexpr std::size_t s_capacity { Capacity }; // NOLINT(readability-identifier-naming)
     static_assert(s_capacity > 0 && (s_capacity & (s_capacity - 1)) == 0, "Capacity must be greater than 0 and a power of 2");
+    static_assert(Stats::bufferCapacity == 0 || Stats::bufferCapacity == s_capacity, "Stats must be sized for the queue's Capacity");
 
     // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
     [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
@@ -0,0 +1,224 @@
+#pragma once
+#include "../common.hpp"
+#include "../shared_memory.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Blockbuster::Spsc {
+
+/**
+ * @brief A wait-free Single-Producer Single-Consumer (SPSC) queue shared between processes.
+ *
+ * The control block and ring live in a POSIX shared memory object (named via shm_open(), or anonymous via
+ * memfd_create() and passed on as a file descriptor) that each process maps with mmap(). The layout contains no
+ * pointers, so it works wherever it is mapped, and starts with a versioned header that attach() validates before
+ * use. Once both sides are attached, enqueue() and dequeue() are plain loads and stores on the mapping, with no
+ * system calls on the data path.
+ *
+ * @tparam T The type of elements stored in the queue. Must be trivially copyable.
+ * @tparam Capacity The maximum number of elements the queue should hold. Must be a power of 2.
+ * @note The actual capacity is (Capacity - 1) due to implementation specifics.
+ */
+template <typename T, std::size_t Capacity>
+class SharedQueue {
+    struct Layout {
+        SharedHeader header;
+
+        // Pad as necessary to avoid false sharing.
+        alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> head;
+        alignas(Blockbuster::cacheLineSize) std::atomic<std::size_t> tail;
+        alignas(Blockbuster::cacheLineSize) std::array<T, Capacity> buffer;
+    };
+
+public:
+    /**
+     * @brief Creates a named shared queue.
+     *
+     * @param name The shared memory object name (e.g. "/orders"). Creation fails if it already exists.
+     * @return The queue, or std::nullopt if the object could not be created or mapped.
+     */
+    static auto create(const char* name) -> std::optional<SharedQueue>
+    {
+        return initialize(SharedMemory::create(name, sizeof(Layout)));
+    }
+
+    /**
+     * @brief Creates an anonymous shared queue whose file descriptor can be inherited or passed to another process.
+     *
+     * @return The queue, or std::nullopt if the memory could not be created or mapped.
+     */
+    static auto createAnonymous() -> std::optional<SharedQueue>
+    {
+        return initialize(SharedMemory::createAnonymous(sizeof(Layout)));
+    }
+
+    /**
+     * @brief Attaches to a named shared queue created by another process.
+     *
+     * @param name The shared memory object name passed to create().
+     * @return The queue, or std::nullopt if the object does not exist, is not ready yet, or has an incompatible layout.
+     */
+    static auto attach(const char* name) -> std::optional<SharedQueue>
+    {
+        return validate(SharedMemory::open(name, sizeof(Layout)));
+    }
+
+    /**
+     * @brief Attaches to a shared queue through a file descriptor.
+     *
+     * @param fd A file descriptor referring to the queue's memory. The queue takes ownership of it.
+     * @return The queue, or std::nullopt if it is not ready yet or has an incompatible layout.
+     */
+    static auto attach(int fd) -> std::optional<SharedQueue>
+    {
+        return validate(SharedMemory::open(fd, sizeof(Layout)));
+    }
+
+    /**
+     * @brief Removes a named shared queue; existing mappings stay valid until they are closed.
+     *
+     * @param name The shared memory object name passed to create().
+     * @return true if the name was removed, false otherwise.
+     */
+    static auto unlink(const char* name) -> bool
+    {
+        return SharedMemory::unlink(name);
+    }
+
+    ~SharedQueue() = default;
+
+    SharedQueue(const SharedQueue&) = delete;
+    auto operator=(const SharedQueue&) -> SharedQueue& = delete;
+    SharedQueue(SharedQueue&&) noexcept = default;
+    auto operator=(SharedQueue&&) -> SharedQueue& = delete;
+
+    /**
+     * @brief Enqueues an item.
+     *
+     * @param item The item to enqueue.
+     * @return true if the item was successfully enqueued, false if the queue was full.
+     */
+    auto enqueue(const T& item) -> bool
+    {
+        const std::size_t currTail { m_layout->tail.load(std::memory_order_relaxed) };
+        const std::size_t nextTail { wrap(currTail + 1) };
+
+        if (nextTail == m_layout->head.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        m_layout->buffer[currTail] = item;
+        m_layout->tail.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeues an item.
+     *
+     * @return An optional containing the dequeued item if successful, or std::nullopt if the queue was empty.
+     */
+    auto dequeue() -> std::optional<T>
+    {
+        const std::size_t currHead { m_layout->head.load(std::memory_order_relaxed) };
+
+        if (currHead == m_layout->tail.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+
+        const T item { m_layout->buffer[currHead] };
+        m_layout->head.store(wrap(currHead + 1), std::memory_order_release);
+        return item;
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if the queue is empty, false otherwise.
+     * @note The return value may be immediately outdated and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return m_layout->head.load(std::memory_order_relaxed) == m_layout->tail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the current number of elements in the queue.
+     *
+     * @return The current number of elements in the queue.
+     * @note The return value may be immediately outdated and should only be used as a heuristic.
+     */
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return wrap(m_layout->tail.load(std::memory_order_relaxed) - m_layout->head.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     *
+     * @return The maximum number of elements the queue can hold.
+     */
+    [[nodiscard]] constexpr auto capacity() const -> std::size_t
+    {
+        return Capacity;
+    }
+
+    /**
+     * @brief Returns the file descriptor backing the queue, e.g. to pass an anonymous queue to another process.
+     *
+     * @return The file descriptor.
+     */
+    [[nodiscard]] auto fd() const -> int
+    {
+        return m_memory.fd();
+    }
+
+private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be greater than 0 and a power of 2");
+    static_assert(std::is_trivially_copyable_v<T>, "Elements shared between processes must be trivially copyable");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Shared atomics must be lock-free");
+
+    static constexpr std::uint64_t s_magic { 0x424C4B5350534351 }; // NOLINT(readability-identifier-naming)
+    static constexpr std::uint32_t s_version { 1 }; // NOLINT(readability-identifier-naming)
+
+    explicit SharedQueue(SharedMemory memory)
+        : m_memory { std::move(memory) }
+        , m_layout { static_cast<Layout*>(m_memory.data()) }
+    {
+    }
+
+    // The memory is freshly zero-filled, so constructing the layout in place leaves every cursor at zero.
+    static auto initialize(std::optional<SharedMemory> memory) -> std::optional<SharedQueue>
+    {
+        if (!memory) {
+            return std::nullopt;
+        }
+        auto* layout { new (memory->data()) Layout };
+        layout->header.publish(s_magic, s_version, sizeof(T), Capacity);
+        return SharedQueue { std::move(*memory) };
+    }
+
+    static auto validate(std::optional<SharedMemory> memory) -> std::optional<SharedQueue>
+    {
+        if (!memory || !static_cast<const Layout*>(memory->data())->header.matches(s_magic, s_version, sizeof(T), Capacity)) {
+            return std::nullopt;
+        }
+        return SharedQueue { std::move(*memory) };
+    }
+
+    // Wraps index to buffer bounds (equivalent to modulo when capacity is a power of 2).
+    [[nodiscard]] auto wrap(std::size_t index) const -> std::size_t
+    {
+        return index & (Capacity - 1);
+    }
+
+    SharedMemory m_memory;
+    Layout* m_layout;
+};
+
+} // namespace Blockbuster::Spsc
@@ -0,0 +1,154 @@
+#pragma once
+#include "clock.hpp"
+#include "common.hpp"
+#include "histogram.hpp"
+#include "stats_policy.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Blockbuster {
+
+/**
+ * @brief A statistics policy for queues that counts outcomes in per-thread counters.
+ *
+ * Pass it as the Stats parameter of a queue to count successful operations, full and empty failures, CAS retries and
+ * the maximum depth observed after an enqueue. Each thread updates its own cache-line-sized slot, so counting adds no
+ * contention between threads; snapshot() sums the slots.
+ *
+ * @tparam Slots The number of counter slots. Must be a power of 2. Threads beyond this share slots, which stays
+ * correct but brings back some contention.
+ * @note Queues call onWrite() and onRead() with the buffer index of an element before publishing or releasing it;
+ * this policy ignores them.
+ */
+template <std::size_t Slots = 16>
+class QueueStats {
+public:
+    static constexpr bool enabled { true };
+    static constexpr std::size_t bufferCapacity { 0 };
+
+    void onEnqueue(std::size_t depth)
+    {
+        Slot& slot { threadSlot() };
+        slot.enqueued.fetch_add(1, std::memory_order_relaxed);
+        std::uint64_t maxDepth { slot.maxDepth.load(std::memory_order_relaxed) };
+        while (depth > maxDepth && !slot.maxDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {
+        }
+    }
+
+    void onEnqueueFull()
+    {
+        threadSlot().enqueueFull.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onDequeue()
+    {
+        threadSlot().dequeued.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onDequeueEmpty()
+    {
+        threadSlot().dequeueEmpty.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onCasRetry()
+    {
+        threadSlot().casRetries.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void onWrite(std::size_t /*index*/) { }
+    void onRead(std::size_t /*index*/) { }
+
+    /**
+     * @brief Sums the counters of every thread.
+     *
+     * @return The statistics so far.
+     * @note Counters are read individually while other threads may be updating them, so the snapshot is not atomic
+     * and should only be used for monitoring.
+     */
+    [[nodiscard]] auto snapshot() const -> QueueStatsSnapshot
+    {
+        QueueStatsSnapshot total {};
+        for (const Slot& slot : m_slots) {
+            total.enqueued += slot.enqueued.load(std::memory_order_relaxed);
+            total.enqueueFull += slot.enqueueFull.load(std::memory_order_relaxed);
+            total.dequeued += slot.dequeued.load(std::memory_order_relaxed);
+            total.dequeueEmpty += slot.dequeueEmpty.load(std::memory_order_relaxed);
+            total.casRetries += slot.casRetries.load(std::memory_order_relaxed);
+            total.maxDepth = std::max<std::uint64_t>(total.maxDepth, slot.maxDepth.load(std::memory_order_relaxed));
+        }
+        return total;
+    }
+
+private:
+    static_assert(Slots > 0 && (Slots & (Slots - 1)) == 0, "Slots must be greater than 0 and a power of 2");
+
+    // Pad as necessary to avoid false sharing.
+    struct alignas(Blockbuster::cacheLineSize) Slot {
+        std::atomic<std::uint64_t> enqueued { 0 };
+        std::atomic<std::uint64_t> enqueueFull { 0 };
+        std::atomic<std::uint64_t> dequeued { 0 };
+        std::atomic<std::uint64_t> dequeueEmpty { 0 };
+        std::atomic<std::uint64_t> casRetries { 0 };
+        std::atomic<std::uint64_t> maxDepth { 0 };
+    };
+
+    auto threadSlot() -> Slot&
+    {
+        return m_slots[Detail::threadIndex() & (Slots - 1)];
+    }
+
+    std::array<Slot, Slots> m_slots {};
+};
+
+/**
+ * @brief A statistics policy for queues that also measures how long each element spends in the queue.
+ *
+ * Every element is timestamped as it is written into its slot, and the time until it is read out is recorded into a
+ * ShardedHistogram, so consumers never contend on the same buckets. The counters of QueueStats are kept as well.
+ *
+ * @tparam Capacity The capacity of the queue the policy is used with. Queues reject a policy sized for another capacity,
+ * since their cells would share timestamp slots.
+ * @tparam Slots The number of histogram shards and counter slots. Must be a power of 2.
+ * @tparam Clock The timestamp source, e.g. SteadyClock (nanoseconds) or TscClock (ticks).
+ * @tparam SubBucketBits The precision of the histogram in bits.
+ */
+template <std::size_t Capacity, std::size_t Slots = 8, typename Clock = SteadyClock, unsigned SubBucketBits = 5>
+class LatencyStats : public QueueStats<Slots> {
+public:
+    static constexpr std::size_t bufferCapacity { Capacity };
+
+    void onWrite(std::size_t index)
+    {
+        m_writeTimes[index & (Capacity - 1)] = Clock::now();
+    }
+
+    void onRead(std::size_t index)
+    {
+        const std::uint64_t now { Clock::now() };
+        const std::uint64_t written { m_writeTimes[index & (Capacity - 1)] };
+        m_latency.record(now > written ? now - written : 0);
+    }
+
+    /**
+     * @brief Returns the distribution of queueing latencies across every consumer.
+     *
+     * @return A snapshot of the latencies in Clock units, e.g. to call percentile(99.9) on.
+     * @note The snapshot is not atomic with concurrent dequeues and should only be used for monitoring.
+     */
+    [[nodiscard]] auto latency() const -> HistogramSnapshot<SubBucketBits>
+    {
+        return m_latency.snapshot();
+    }
+
+private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be greater than 0 and a power of 2");
+
+    // Written before an element is published and read before its slot is released, so the queue orders the accesses.
+    std::array<std::uint64_t, Capacity> m_writeTimes {};
+    ShardedHistogram<Slots, SubBucketBits> m_latency {};
+};
+
+} // namespace Blockbuster
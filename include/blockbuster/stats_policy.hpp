@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Blockbuster {
+
+/**
+ * @brief A point-in-time copy of a queue's statistics.
+ */
+struct QueueStatsSnapshot {
+    std::uint64_t enqueued;
+    std::uint64_t enqueueFull;
+    std::uint64_t dequeued;
+    std::uint64_t dequeueEmpty;
+    // Failed compare-exchanges on a queue cursor, i.e. operations that lost a race with another thread.
+    std::uint64_t casRetries;
+    std::uint64_t maxDepth;
+};
+
+/**
+ * @brief The default statistics policy for queues, which records nothing and compiles away entirely.
+ *
+ * It also defines the hooks a policy must provide, which queues call as operations succeed or fail. Policies that
+ * record something are declared in stats.hpp.
+ */
+class NoStats {
+public:
+    static constexpr bool enabled { false };
+    // The buffer capacity the policy is sized for, or 0 if it works with any queue.
+    static constexpr std::size_t bufferCapacity { 0 };
+
+    void onEnqueue(std::size_t /*depth*/) { }
+    void onEnqueueFull() { }
+    void onDequeue() { }
+    void onDequeueEmpty() { }
+    void onCasRetry() { }
+    void onWrite(std::size_t /*index*/) { }
+    void onRead(std::size_t /*index*/) { }
+
+    /**
+     * @brief Returns empty statistics.
+     *
+     * @return A snapshot with every counter at zero.
+     */
+    [[nodiscard]] auto snapshot() const -> QueueStatsSnapshot
+    {
+        return {};
+    }
+};
+
+} // namespace Blockbuster
@@ -0,0 +1,301 @@
+#pragma once
+#include "../clock.hpp"
+#include "../spmc/overwrite_ring.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#ifndef BLOCKBUSTER_TRACE_RING_CAPACITY
+#define BLOCKBUSTER_TRACE_RING_CAPACITY 4096
+#endif
+
+#ifndef BLOCKBUSTER_TRACE_RETAINED_THREADS
+#define BLOCKBUSTER_TRACE_RETAINED_THREADS 64
+#endif
+
+namespace Blockbuster::Trace {
+
+/**
+ * @brief The number of events each thread's flight recorder retains. Must be a power of 2.
+ *
+ * Override by defining BLOCKBUSTER_TRACE_RING_CAPACITY consistently across the program.
+ */
+constexpr std::size_t ringCapacity { BLOCKBUSTER_TRACE_RING_CAPACITY };
+
+/**
+ * @brief The number of exited threads whose flight recorders are retained until the next dump.
+ *
+ * Once more threads than this have exited, the rings of those that exited first are dropped, so programs that keep
+ * starting threads use bounded memory. Override by defining BLOCKBUSTER_TRACE_RETAINED_THREADS.
+ */
+constexpr std::size_t retainedThreads { BLOCKBUSTER_TRACE_RETAINED_THREADS };
+
+/**
+ * @brief The kinds of events recorded by the library's own instrumentation.
+ *
+ * Applications may record their own kinds, numbered from user upwards.
+ */
+enum class EventKind : std::uint32_t {
+    enqueue,
+    enqueueFull,
+    dequeue,
+    dequeueEmpty,
+    user = 1U << 16
+};
+
+/**
+ * @brief A compact timestamped event, stored in the dump file exactly as laid out here.
+ *
+ * The object is the address of whatever the event concerns (e.g. a queue), and the value is kind-specific (e.g. the
+ * queue position), truncated to 32 bits.
+ */
+struct Event {
+    std::uint64_t timestamp;
+    std::uint64_t object;
+    std::uint32_t kind;
+    std::uint32_t value;
+};
+
+/**
+ * @brief The events retained for one thread at the time of a snapshot, oldest first.
+ *
+ * The recorded count includes events that have since been overwritten.
+ */
+struct ThreadTrace {
+    std::uint64_t threadId;
+    std::uint64_t recordedCount;
+    std::vector<Event> events;
+};
+
+/**
+ * @brief Reads the timestamp counter used for events (see TscClock).
+ *
+ * @return The current counter value.
+ */
+inline auto timestamp() -> std::uint64_t
+{
+    return TscClock::now();
+}
+
+namespace Detail {
+
+    struct ThreadRing {
+        Spmc::OverwriteRing<Event, ringCapacity> ring {};
+        std::uint64_t threadId { static_cast<std::uint64_t>(::syscall(SYS_gettid)) };
+    };
+
+    // A reference point pairing the timestamp counter with the steady clock, so that dumps can be converted offline.
+    struct ClockPoint {
+        std::uint64_t timestamp { Trace::timestamp() };
+        std::uint64_t nanoseconds { SteadyClock::now() };
+    };
+
+    // Rings outlive their threads so that a dump still shows what a thread did before it exited; they are released
+    // once a dump has written them, or when more than retainedThreads threads have exited since.
+    class Registry {
+    public:
+        static auto instance() -> Registry&
+        {
+            static Registry registry {};
+            return registry;
+        }
+
+        auto add() -> std::shared_ptr<ThreadRing>
+        {
+            auto ring { std::make_shared<ThreadRing>() };
+            const std::lock_guard<std::mutex> lock { m_mutex };
+            m_rings.push_back(ring);
+            return ring;
+        }
+
+        void retire(const std::shared_ptr<ThreadRing>& ring)
+        {
+            const std::lock_guard<std::mutex> lock { m_mutex };
+            m_rings.erase(std::find(m_rings.begin(), m_rings.end(), ring));
+            m_retired.push_back(ring);
+            if (m_retired.size() > retainedThreads) {
+                m_retired.pop_front();
+            }
+        }
+
+        [[nodiscard]] auto rings() -> std::vector<std::shared_ptr<ThreadRing>>
+        {
+            const std::lock_guard<std::mutex> lock { m_mutex };
+            std::vector<std::shared_ptr<ThreadRing>> rings { m_retired.begin(), m_retired.end() };
+            rings.insert(rings.end(), m_rings.begin(), m_rings.end());
+            return rings;
+        }
+
+        void release(const std::vector<std::shared_ptr<ThreadRing>>& written)
+        {
+            const std::lock_guard<std::mutex> lock { m_mutex };
+            m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(),
+                                [&written](const std::shared_ptr<ThreadRing>& ring) {
+                                    return std::find(written.begin(), written.end(), ring) != written.end();
+                                }),
+                m_retired.end());
+        }
+
+        [[nodiscard]] auto start() const -> const ClockPoint&
+        {
+            return m_start;
+        }
+
+    private:
+        ClockPoint m_start {};
+        std::mutex m_mutex {};
+        std::vector<std::shared_ptr<ThreadRing>> m_rings {};
+        std::deque<std::shared_ptr<ThreadRing>> m_retired {};
+    };
+
+    struct ThreadRegistration {
+        std::shared_ptr<ThreadRing> ring { Registry::instance().add() };
+
+        ~ThreadRegistration()
+        {
+            Registry::instance().retire(ring);
+        }
+    };
+
+    inline auto threadRing() -> ThreadRing&
+    {
+        static thread_local ThreadRing* cached { nullptr };
+        if (cached == nullptr) {
+            static thread_local ThreadRegistration registration {};
+            cached = registration.ring.get();
+        }
+        return *cached;
+    }
+
+    inline auto snapshot(ThreadRing& ring) -> ThreadTrace
+    {
+        ThreadTrace trace { ring.threadId, ring.ring.pushedCount(), {} };
+        trace.events.reserve(ringCapacity);
+
+        // Bounded so that a thread recording faster than the copy cannot keep the snapshot going forever.
+        auto reader { ring.ring.makeReader() };
+        while (trace.events.size() < ringCapacity) {
+            const std::optional<Event> event { reader.read() };
+            if (!event) {
+                break;
+            }
+            trace.events.push_back(*event);
+        }
+        return trace;
+    }
+
+} // namespace Detail
+
+/**
+ * @brief Records an event in the calling thread's flight recorder.
+ *
+ * Each thread records into its own Spmc::OverwriteRing of the last ringCapacity events, so recording never blocks,
+ * never fails and never contends with other threads. The first event on a thread allocates and registers its ring.
+ *
+ * @param kind The event kind.
+ * @param object The object the event concerns, or nullptr.
+ * @param value A kind-specific value.
+ */
+inline void record(EventKind kind, const void* object, std::uint64_t value)
+{
+    Detail::threadRing().ring.push({ timestamp(), reinterpret_cast<std::uintptr_t>(object), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        static_cast<std::uint32_t>(kind), static_cast<std::uint32_t>(value) });
+}
+
+/**
+ * @brief Copies the events currently retained by every thread's flight recorder.
+ *
+ * Threads may keep recording during the copy; events they overwrite before the copy reaches them are left out.
+ *
+ * @return One trace per thread that has recorded an event, including up to retainedThreads threads that have since
+ * exited.
+ */
+inline auto snapshot() -> std::vector<ThreadTrace>
+{
+    std::vector<ThreadTrace> traces {};
+    for (const auto& ring : Detail::Registry::instance().rings()) {
+        traces.push_back(Detail::snapshot(*ring));
+    }
+    return traces;
+}
+
+constexpr std::uint64_t dumpMagic { 0x424C4B5452414345 }; // "BLKTRACE"
+constexpr std::uint32_t dumpVersion { 1 };
+
+/**
+ * @brief The header at the start of a dump file.
+ *
+ * The two clock points pair the timestamp counter with the steady clock in nanoseconds, so that timestamps can be
+ * converted to time: the counter frequency is (dumpTimestamp - startTimestamp) / (dumpNanoseconds - startNanoseconds).
+ * The start point is taken when the first thread starts recording.
+ */
+struct DumpHeader {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t eventSize;
+    std::uint64_t startTimestamp;
+    std::uint64_t startNanoseconds;
+    std::uint64_t dumpTimestamp;
+    std::uint64_t dumpNanoseconds;
+    std::uint64_t threadCount;
+};
+
+/**
+ * @brief The header of each thread's section in a dump file, which is followed by eventCount events.
+ */
+struct DumpThreadHeader {
+    std::uint64_t threadId;
+    std::uint64_t recordedCount;
+    std::uint64_t eventCount;
+};
+
+/**
+ * @brief Writes a snapshot of every thread's flight recorder to a binary file for offline analysis.
+ *
+ * The file starts with a DumpHeader, followed for each thread by a DumpThreadHeader and its events as an array of
+ * Event, all in native byte order. Rings of exited threads are released once they have been dumped.
+ *
+ * @param path The file to write. It is replaced if it exists.
+ * @return true if the file was written, false otherwise.
+ */
+inline auto dump(const char* path) -> bool
+{
+    const std::vector<std::shared_ptr<Detail::ThreadRing>> rings { Detail::Registry::instance().rings() };
+    std::vector<ThreadTrace> traces {};
+    for (const auto& ring : rings) {
+        traces.push_back(Detail::snapshot(*ring));
+    }
+
+    const Detail::ClockPoint start { Detail::Registry::instance().start() };
+    const Detail::ClockPoint now {};
+    const DumpHeader header { dumpMagic, dumpVersion, sizeof(Event), start.timestamp, start.nanoseconds, now.timestamp,
+        now.nanoseconds, traces.size() };
+
+    std::FILE* file { std::fopen(path, "wb") };
+    if (file == nullptr) {
+        return false;
+    }
+    bool written { std::fwrite(&header, sizeof(header), 1, file) == 1 };
+    for (const ThreadTrace& trace : traces) {
+        const DumpThreadHeader threadHeader { trace.threadId, trace.recordedCount, trace.events.size() };
+        written = written && std::fwrite(&threadHeader, sizeof(threadHeader), 1, file) == 1
+            && std::fwrite(trace.events.data(), sizeof(Event), trace.events.size(), file) == trace.events.size();
+    }
+    written = std::fclose(file) == 0 && written;
+
+    if (written) {
+        Detail::Registry::instance().release(rings);
+    }
+    return written;
+}
+
+} // namespace Blockbuster::Trace
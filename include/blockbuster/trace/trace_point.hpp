@@ -0,0 +1,20 @@
+#pragma once
+
+#ifdef BLOCKBUSTER_ENABLE_TRACING
+#include "flight_recorder.hpp"
+
+/**
+ * @brief Records a library event in the calling thread's flight recorder.
+ *
+ * Compiled out entirely, including its arguments, unless BLOCKBUSTER_ENABLE_TRACING is defined. Define it
+ * consistently across the program, as it changes the definitions of instrumented templates.
+ *
+ * @param kind The name of a Blockbuster::Trace::EventKind enumerator.
+ * @param object The object the event concerns.
+ * @param value A kind-specific value.
+ */
+#define BLOCKBUSTER_TRACE(kind, object, value) \
+    ::Blockbuster::Trace::record(::Blockbuster::Trace::EventKind::kind, object, value)
+#else
+#define BLOCKBUSTER_TRACE(kind, object, value) static_cast<void>(0)
+#endif
@@ -0,0 +1,100 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "counter.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::int64_t batch { 8 };
+
+class CounterTest : public ::testing::Test {
+protected:
+    Blockbuster::Counter<4> counter { batch };
+};
+
+TEST_F(CounterTest, AddAndSub)
+{
+    EXPECT_EQ(counter.sum(), 0);
+    counter.add();
+    counter.add(5);
+    counter.sub(2);
+    EXPECT_EQ(counter.sum(), 4);
+    counter.sub(10);
+    EXPECT_EQ(counter.sum(), -6);
+}
+
+TEST_F(CounterTest, ReadIsWithinBatch)
+{
+    for (int i { 0 }; i < 100; ++i) {
+        counter.add();
+        EXPECT_LE(counter.read(), counter.sum());
+        EXPECT_LT(counter.sum() - counter.read(), batch);
+    }
+    EXPECT_EQ(counter.sum(), 100);
+}
+
+TEST_F(CounterTest, ConcurrentAdds)
+{
+    constexpr int counterThreads { 8 };
+    constexpr std::int64_t addsPerThread { 200000 };
+
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < counterThreads; ++t) {
+        threads.emplace_back([this]() {
+            for (std::int64_t i { 0 }; i < addsPerThread; ++i) {
+                counter.add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.sum(), counterThreads * addsPerThread);
+    EXPECT_LE(counter.sum() - counter.read(), 4 * batch);
+}
+
+TEST_F(CounterTest, SumCountsEachAddOnce)
+{
+    constexpr int counterThreads { 4 };
+    constexpr std::int64_t addsPerThread { 200000 };
+
+    std::array<std::atomic<std::int64_t>, counterThreads> started {};
+    std::array<std::atomic<std::int64_t>, counterThreads> completed {};
+    std::atomic<bool> done { false };
+    std::vector<std::thread> threads {};
+    for (std::size_t t { 0 }; t < counterThreads; ++t) {
+        threads.emplace_back([this, &started, &completed, t]() {
+            for (std::int64_t i { 0 }; i < addsPerThread; ++i) {
+                started[t].store(i + 1, std::memory_order_release);
+                counter.add();
+                completed[t].store(i + 1, std::memory_order_release);
+            }
+        });
+    }
+    std::thread reader { [this, &started, &completed, &done]() {
+        while (!done.load(std::memory_order_relaxed)) {
+            std::int64_t floor { 0 };
+            for (const auto& count : completed) {
+                floor += count.load(std::memory_order_acquire);
+            }
+            const std::int64_t sum { counter.sum() };
+            std::int64_t ceiling { 0 };
+            for (const auto& count : started) {
+                ceiling += count.load(std::memory_order_acquire);
+            }
+            ASSERT_GE(sum, floor);
+            ASSERT_LE(sum, ceiling);
+        }
+    } };
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true, std::memory_order_relaxed);
+    reader.join();
+    EXPECT_EQ(counter.sum(), counterThreads * addsPerThread);
+}
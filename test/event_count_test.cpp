@@ -0,0 +1,100 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "event_count.hpp"
+#include "mpmc/queue.hpp"
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t eventQueueCapacity { 64 };
+
+class EventCountTest : public ::testing::Test {
+protected:
+    Blockbuster::EventCount events;
+};
+
+TEST_F(EventCountTest, CancelWait)
+{
+    EXPECT_EQ(events.waiterCount(), 0);
+    static_cast<void>(events.prepareWait());
+    EXPECT_EQ(events.waiterCount(), 1);
+    events.cancelWait();
+    EXPECT_EQ(events.waiterCount(), 0);
+}
+
+TEST_F(EventCountTest, NotifyBeforeCommitIsNotLost)
+{
+    const auto key { events.prepareWait() };
+    events.notify();
+    // Returns immediately because the epoch moved on after the key was taken.
+    events.commitWait(key);
+    EXPECT_EQ(events.waiterCount(), 0);
+}
+
+TEST_F(EventCountTest, NotifyWakesWaiter)
+{
+    std::atomic<bool> ready { false };
+    std::thread waiter { [&]() { events.wait([&ready]() { return ready.load(std::memory_order_acquire); }); } };
+
+    while (events.waiterCount() == 0) {
+        std::this_thread::yield();
+    }
+    ready.store(true, std::memory_order_release);
+    events.notify();
+    waiter.join();
+    EXPECT_EQ(events.waiterCount(), 0);
+}
+
+TEST_F(EventCountTest, NotifyAllWakesEveryWaiter)
+{
+    constexpr std::uint32_t waiterThreads { 4 };
+    std::atomic<bool> ready { false };
+    std::vector<std::thread> waiters {};
+    for (std::uint32_t i { 0 }; i < waiterThreads; ++i) {
+        waiters.emplace_back([&]() { events.wait([&ready]() { return ready.load(std::memory_order_acquire); }); });
+    }
+
+    while (events.waiterCount() < waiterThreads) {
+        std::this_thread::yield();
+    }
+    ready.store(true, std::memory_order_release);
+    events.notifyAll();
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+}
+
+TEST_F(EventCountTest, BlockingQueueConsumers)
+{
+    constexpr int consumerThreads { 3 };
+    constexpr int itemsPerConsumer { 20000 };
+    Blockbuster::Mpmc::Queue<int, eventQueueCapacity> queue {};
+    Blockbuster::EventCount notFull {};
+    std::atomic<long> sum { 0 };
+
+    std::vector<std::thread> consumers {};
+    for (int c { 0 }; c < consumerThreads; ++c) {
+        consumers.emplace_back([&]() {
+            for (int i { 0 }; i < itemsPerConsumer; ++i) {
+                std::optional<int> item {};
+                events.wait([&]() { return (item = queue.dequeue()).has_value(); });
+                sum.fetch_add(*item, std::memory_order_relaxed);
+                notFull.notify();
+            }
+        });
+    }
+
+    long expected { 0 };
+    for (int i { 1 }; i <= consumerThreads * itemsPerConsumer; ++i) {
+        notFull.wait([&]() { return queue.enqueue(i); });
+        events.notify();
+        expected += i;
+    }
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+    EXPECT_EQ(sum.load(), expected);
+}
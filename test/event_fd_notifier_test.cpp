@@ -0,0 +1,109 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "event_fd_notifier.hpp"
+#include "spsc/queue.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <thread>
+#include <unistd.h>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t notifierQueueCapacity { 256 };
+
+class EventFdNotifierTest : public ::testing::Test {
+protected:
+    void SetUp() override { ASSERT_TRUE(notifier.has_value()); }
+
+    [[nodiscard]] auto readable() const -> bool
+    {
+        pollfd entry { notifier->fd(), POLLIN, 0 };
+        return ::poll(&entry, 1, 0) == 1 && (entry.revents & POLLIN) != 0;
+    }
+
+    std::optional<Blockbuster::EventFdNotifier> notifier { Blockbuster::EventFdNotifier::create() };
+};
+
+TEST_F(EventFdNotifierTest, SignalsOnlyOncePerArm)
+{
+    EXPECT_TRUE(notifier->armed());
+    EXPECT_FALSE(readable());
+
+    notifier->notify();
+    notifier->notify();
+    EXPECT_FALSE(notifier->armed());
+    ASSERT_TRUE(readable());
+
+    std::uint64_t count {};
+    ASSERT_EQ(::read(notifier->fd(), &count, sizeof(count)), static_cast<ssize_t>(sizeof(count)));
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(readable());
+}
+
+TEST_F(EventFdNotifierTest, AcknowledgeAndRearm)
+{
+    notifier->notify();
+    notifier->acknowledge();
+    EXPECT_FALSE(readable());
+
+    notifier->notify();
+    EXPECT_FALSE(readable());
+
+    notifier->arm();
+    notifier->notify();
+    EXPECT_TRUE(readable());
+    notifier->acknowledge();
+
+    notifier->arm();
+    notifier->disarm();
+    notifier->notify();
+    EXPECT_FALSE(readable());
+}
+
+TEST_F(EventFdNotifierTest, EpollConsumer)
+{
+    constexpr int itemCount { 100000 };
+    Blockbuster::Spsc::Queue<int, notifierQueueCapacity> queue {};
+
+    const int epollFd { ::epoll_create1(EPOLL_CLOEXEC) };
+    ASSERT_GE(epollFd, 0);
+    epoll_event event { EPOLLIN, {} };
+    ASSERT_EQ(::epoll_ctl(epollFd, EPOLL_CTL_ADD, notifier->fd(), &event), 0);
+
+    std::thread producer { [&]() {
+        for (int i { 0 }; i < itemCount; ++i) {
+            while (!queue.enqueue(i)) {
+                std::this_thread::yield();
+            }
+            notifier->notify();
+        }
+    } };
+
+    int expected { 0 };
+    int wakeups { 0 };
+    while (expected < itemCount) {
+        epoll_event ready {};
+        // A timeout would mean a lost notification.
+        ASSERT_EQ(::epoll_wait(epollFd, &ready, 1, 10000), 1);
+        ++wakeups;
+        notifier->acknowledge();
+
+        for (;;) {
+            while (const auto item { queue.dequeue() }) {
+                EXPECT_EQ(*item, expected);
+                ++expected;
+            }
+            notifier->arm();
+            if (queue.empty()) {
+                break;
+            }
+            notifier->disarm();
+        }
+    }
+
+    producer.join();
+    ::close(epollFd);
+    EXPECT_LE(wakeups, itemCount);
+}
@@ -0,0 +1,114 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "execution/queue_scheduler.hpp"
+#include "execution/queue_sender.hpp"
+#include "execution/sender.hpp"
+#include "mpmc/queue.hpp"
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <optional>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t schedulerCapacity { 64 };
+
+namespace Execution = Blockbuster::Execution;
+
+class ExecutionQueueSchedulerTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        worker = std::thread { [this]() {
+            workerId = std::this_thread::get_id();
+            context.run();
+        } };
+    }
+
+    void TearDown() override
+    {
+        context.stop();
+        worker.join();
+    }
+
+    Execution::QueueScheduler<schedulerCapacity> context;
+    std::thread worker;
+    std::thread::id workerId;
+};
+
+TEST_F(ExecutionQueueSchedulerTest, RunsOnContext)
+{
+    const auto scheduler { context.getScheduler() };
+    EXPECT_EQ(scheduler, context.getScheduler());
+
+    const auto id { Execution::syncWait(scheduler.schedule() | Execution::then([]() { return std::this_thread::get_id(); })) };
+    ASSERT_TRUE(id.has_value());
+    EXPECT_NE(*id, std::this_thread::get_id());
+    EXPECT_EQ(*id, workerId);
+}
+
+TEST_F(ExecutionQueueSchedulerTest, QueueSendersStartOnContext)
+{
+    Blockbuster::Mpmc::Queue<int, schedulerCapacity> queue {};
+    EXPECT_EQ(Execution::syncWait(Execution::startsOn(context.getScheduler(), Execution::enqueueSender(queue, 41))), true);
+
+    const auto result { Execution::syncWait(Execution::startsOn(context.getScheduler(), Execution::dequeueSender(queue))
+        | Execution::then([](std::optional<int> item) { return std::make_pair(item.value_or(0) + 1, std::this_thread::get_id()); })) };
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->first, 42);
+    EXPECT_EQ(result->second, workerId);
+}
+
+TEST_F(ExecutionQueueSchedulerTest, ConcurrentSchedulers)
+{
+    constexpr int threadCount { 4 };
+    constexpr int tasksPerThread { 2000 };
+    std::atomic<int> completed { 0 };
+
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            for (int i { 0 }; i < tasksPerThread; ++i) {
+                EXPECT_TRUE(Execution::syncWait(context.getScheduler().schedule()
+                    | Execution::then([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); })));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(completed.load(), threadCount * tasksPerThread);
+}
+
+namespace {
+
+struct RecordingReceiver {
+    int* values;
+    int* stops;
+
+    void set_value() { ++*values; }
+    void set_stopped() { ++*stops; }
+};
+
+} // namespace
+
+TEST(ExecutionQueueSchedulerPollTest, PollAndStopOnDestruction)
+{
+    int values { 0 };
+    int stops { 0 };
+    std::optional<Execution::QueueScheduler<schedulerCapacity>> context {};
+    context.emplace();
+    auto first { context->getScheduler().schedule().connect(RecordingReceiver { &values, &stops }) };
+    auto second { context->getScheduler().schedule().connect(RecordingReceiver { &values, &stops }) };
+
+    first.start();
+    EXPECT_EQ(values, 0);
+    EXPECT_EQ(context->poll(), 1);
+    EXPECT_EQ(values, 1);
+
+    // The operation is still queued when the context goes away.
+    second.start();
+    context.reset();
+    EXPECT_EQ(values, 1);
+    EXPECT_EQ(stops, 1);
+}
@@ -0,0 +1,40 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "execution/queue_sender.hpp"
+#include "execution/sender.hpp"
+#include "mpmc/queue.hpp"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <optional>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t senderQueueCapacity { 2 };
+
+class ExecutionQueueSenderTest : public ::testing::Test {
+protected:
+    Blockbuster::Mpmc::Queue<int, senderQueueCapacity> queue;
+};
+
+namespace Execution = Blockbuster::Execution;
+
+TEST_F(ExecutionQueueSenderTest, EnqueueUntilFull)
+{
+    EXPECT_EQ(Execution::syncWait(Execution::enqueueSender(queue, 1)), true);
+    EXPECT_EQ(Execution::syncWait(Execution::enqueueSender(queue, 2)), true);
+    EXPECT_EQ(Execution::syncWait(Execution::enqueueSender(queue, 3)), false);
+    EXPECT_EQ(queue.size(), senderQueueCapacity);
+}
+
+TEST_F(ExecutionQueueSenderTest, DequeueUntilEmpty)
+{
+    queue.enqueue(1);
+    EXPECT_EQ(Execution::syncWait(Execution::dequeueSender(queue)), std::make_optional(std::optional<int> { 1 }));
+    EXPECT_EQ(Execution::syncWait(Execution::dequeueSender(queue)), std::make_optional(std::optional<int> {}));
+}
+
+TEST_F(ExecutionQueueSenderTest, ComposesWithThen)
+{
+    queue.enqueue(20);
+    const auto result { Execution::syncWait(Execution::dequeueSender(queue)
+        | Execution::then([](std::optional<int> item) { return item.value_or(0) * 2 + 2; })) };
+    EXPECT_EQ(result, 42);
+}
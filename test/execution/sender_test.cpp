@@ -0,0 +1,80 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "execution/sender.hpp"
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+// A scheduler that completes inline, or stops every operation when told to.
+struct InlineScheduler {
+    struct ScheduleSender {
+        using ValueType = void;
+
+        template <typename Receiver>
+        struct Operation {
+            bool stopped;
+            Receiver receiver;
+
+            void start() noexcept
+            {
+                if (stopped) {
+                    receiver.set_stopped();
+                } else {
+                    receiver.set_value();
+                }
+            }
+        };
+
+        bool stopped;
+
+        template <typename Receiver>
+        auto connect(Receiver receiver) && -> Operation<Receiver>
+        {
+            return Operation<Receiver> { stopped, std::move(receiver) };
+        }
+    };
+
+    [[nodiscard]] auto schedule() const -> ScheduleSender { return ScheduleSender { stopped }; }
+
+    bool stopped { false };
+};
+
+} // namespace
+
+namespace Execution = Blockbuster::Execution;
+
+TEST(ExecutionSenderTest, Just)
+{
+    EXPECT_EQ(Execution::syncWait(Execution::just(42)), 42);
+}
+
+TEST(ExecutionSenderTest, ThenChains)
+{
+    const std::optional<std::string> result { Execution::syncWait(Execution::then(Execution::just(20), [](int value) {
+        return value + 1;
+    }) | Execution::then([](int value) { return std::to_string(value * 2); })) };
+    EXPECT_EQ(result, "42");
+}
+
+TEST(ExecutionSenderTest, ThenToVoid)
+{
+    int seen { 0 };
+    EXPECT_TRUE(Execution::syncWait(Execution::just(7) | Execution::then([&seen](int value) { seen = value; })));
+    EXPECT_EQ(seen, 7);
+}
+
+TEST(ExecutionSenderTest, StartsOnForwardsValueAndStop)
+{
+    EXPECT_EQ(Execution::syncWait(Execution::startsOn(InlineScheduler {}, Execution::just(5))), 5);
+
+    bool ran { false };
+    const auto stopped { Execution::syncWait(
+        Execution::startsOn(InlineScheduler { true }, Execution::just(5) | Execution::then([&ran](int value) {
+            ran = true;
+            return value;
+        }))) };
+    EXPECT_FALSE(stopped.has_value());
+    EXPECT_FALSE(ran);
+}
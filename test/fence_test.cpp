@@ -0,0 +1,67 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "fence.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+// NOLINTEND(llvm-include-order)
+
+constexpr int handshakeRounds { 20000 };
+
+TEST(FenceTest, AvailabilityIsStable)
+{
+    const bool available { Blockbuster::asymmetricFencesAvailable() };
+    Blockbuster::lightFence();
+    Blockbuster::heavyFence();
+    EXPECT_EQ(Blockbuster::asymmetricFencesAvailable(), available);
+}
+
+// The store-buffering litmus test: with a light fence on one side and a heavy fence on the other, at least one thread
+// must see the other's store.
+TEST(FenceTest, LightAndHeavyFencesOrderStoreBuffering)
+{
+    std::atomic<int> round { 0 };
+    std::atomic<int> arrived { 0 };
+    std::atomic<int> x { 0 };
+    std::atomic<int> y { 0 };
+    int seenByLight { 0 };
+    int seenByHeavy { 0 };
+    int bothMissed { 0 };
+
+    auto waitForRound = [&round](int expected) {
+        while (round.load(std::memory_order_acquire) != expected) {
+            std::this_thread::yield();
+        }
+    };
+
+    std::thread light { [&]() {
+        for (int i { 1 }; i <= handshakeRounds; ++i) {
+            waitForRound(i);
+            x.store(i, std::memory_order_relaxed);
+            Blockbuster::lightFence();
+            seenByLight = y.load(std::memory_order_relaxed);
+            arrived.fetch_add(1, std::memory_order_acq_rel);
+        }
+    } };
+
+    std::thread heavy { [&]() {
+        for (int i { 1 }; i <= handshakeRounds; ++i) {
+            waitForRound(i);
+            y.store(i, std::memory_order_relaxed);
+            Blockbuster::heavyFence();
+            seenByHeavy = x.load(std::memory_order_relaxed);
+            arrived.fetch_add(1, std::memory_order_acq_rel);
+        }
+    } };
+
+    for (int i { 1 }; i <= handshakeRounds; ++i) {
+        round.store(i, std::memory_order_release);
+        while (arrived.load(std::memory_order_acquire) != 2 * i) {
+            std::this_thread::yield();
+        }
+        bothMissed += (seenByLight != i && seenByHeavy != i) ? 1 : 0;
+    }
+
+    light.join();
+    heavy.join();
+    EXPECT_EQ(bothMissed, 0);
+}
@@ -0,0 +1,142 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "histogram.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr int histogramThreads { 4 };
+constexpr std::uint64_t recordsPerThread { 100000 };
+
+class HistogramTest : public ::testing::Test {
+protected:
+    Blockbuster::Histogram<> histogram;
+};
+
+TEST_F(HistogramTest, EmptyHistogram)
+{
+    const auto snapshot { histogram.snapshot() };
+    EXPECT_EQ(snapshot.count(), 0);
+    EXPECT_EQ(snapshot.min(), 0);
+    EXPECT_EQ(snapshot.max(), 0);
+    EXPECT_EQ(snapshot.percentile(50), 0);
+    EXPECT_EQ(snapshot.mean(), 0);
+}
+
+TEST_F(HistogramTest, SmallValuesAreExact)
+{
+    for (std::uint64_t value { 1 }; value <= 20; ++value) {
+        histogram.record(value);
+    }
+    const auto snapshot { histogram.snapshot() };
+    EXPECT_EQ(snapshot.count(), 20);
+    EXPECT_EQ(snapshot.min(), 1);
+    EXPECT_EQ(snapshot.max(), 20);
+    EXPECT_EQ(snapshot.percentile(0), 1);
+    EXPECT_EQ(snapshot.percentile(50), 10);
+    EXPECT_EQ(snapshot.percentile(95), 19);
+    EXPECT_EQ(snapshot.percentile(100), 20);
+    EXPECT_DOUBLE_EQ(snapshot.mean(), 10.5);
+}
+
+TEST_F(HistogramTest, LargeValuesWithinRelativeError)
+{
+    constexpr double relativeError { 1.0 / 16 };
+    for (const std::uint64_t value : { std::uint64_t { 1000 }, std::uint64_t { 123456789 }, std::uint64_t { 1 } << 40 }) {
+        Blockbuster::Histogram<> single {};
+        single.record(value);
+        single.record(value * 2);
+        const auto reported { static_cast<double>(single.snapshot().percentile(50)) };
+        EXPECT_GE(reported, static_cast<double>(value));
+        EXPECT_LE(reported, static_cast<double>(value) * (1 + relativeError));
+    }
+
+    histogram.record(std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(histogram.snapshot().percentile(100), std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST_F(HistogramTest, TailPercentiles)
+{
+    for (int i { 0 }; i < 9990; ++i) {
+        histogram.record(100);
+    }
+    for (int i { 0 }; i < 10; ++i) {
+        histogram.record(1000000);
+    }
+    const auto snapshot { histogram.snapshot() };
+    EXPECT_LE(snapshot.percentile(99), 100 * 17 / 16);
+    EXPECT_LE(snapshot.percentile(99.9), 100 * 17 / 16);
+    EXPECT_GE(snapshot.percentile(99.95), 1000000);
+    EXPECT_GE(snapshot.max(), 1000000);
+    EXPECT_LE(snapshot.max(), 1000000 * 17 / 16);
+}
+
+TEST_F(HistogramTest, MergeAndReset)
+{
+    histogram.record(5);
+    Blockbuster::HistogramSnapshot<> merged { histogram.snapshot() };
+
+    Blockbuster::Histogram<> other {};
+    other.record(1000);
+    merged.merge(other.snapshot());
+    merged.record(7, 3);
+
+    EXPECT_EQ(merged.count(), 5);
+    EXPECT_EQ(merged.min(), 5);
+    EXPECT_GE(merged.max(), 1000);
+    EXPECT_LE(merged.max(), 1000 * 17 / 16);
+    EXPECT_EQ(merged.percentile(80), 7);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.snapshot().count(), 0);
+    EXPECT_EQ(histogram.snapshot().max(), 0);
+}
+
+TEST_F(HistogramTest, ConcurrentRecords)
+{
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < histogramThreads; ++t) {
+        threads.emplace_back([this]() {
+            for (std::uint64_t i { 0 }; i < recordsPerThread; ++i) {
+                histogram.record(i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto snapshot { histogram.snapshot() };
+    EXPECT_EQ(snapshot.count(), histogramThreads * recordsPerThread);
+    EXPECT_EQ(snapshot.min(), 0);
+    EXPECT_GE(snapshot.max(), recordsPerThread - 1);
+    EXPECT_LE(snapshot.max(), (recordsPerThread - 1) * 17 / 16);
+}
+
+TEST(ShardedHistogramTest, ConcurrentRecords)
+{
+    Blockbuster::ShardedHistogram<2> histogram {};
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < histogramThreads; ++t) {
+        threads.emplace_back([&histogram, t]() {
+            for (std::uint64_t i { 0 }; i < recordsPerThread; ++i) {
+                histogram.record(static_cast<std::uint64_t>(t) * recordsPerThread + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot { histogram.snapshot() };
+    EXPECT_EQ(snapshot.count(), histogramThreads * recordsPerThread);
+    EXPECT_EQ(snapshot.min(), 0);
+    EXPECT_GE(snapshot.max(), histogramThreads * recordsPerThread - 1);
+    EXPECT_LE(snapshot.max(), (histogramThreads * recordsPerThread - 1) * 17 / 16);
+    const auto median { static_cast<double>(snapshot.percentile(50)) };
+    EXPECT_NEAR(median, histogramThreads * recordsPerThread / 2.0, histogramThreads * recordsPerThread / 16.0);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.snapshot().count(), 0);
+}
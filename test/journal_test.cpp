@@ -0,0 +1,244 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "journal.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t fileSize { 4096 };
+
+using Journal = Blockbuster::Journal<fileSize>;
+
+class JournalTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        std::string pattern { (std::filesystem::temp_directory_path() / "blockbuster_journal_XXXXXX").string() };
+        ASSERT_NE(mkdtemp(pattern.data()), nullptr);
+        directory = pattern;
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    static auto append(Journal::Appender& appender, std::uint64_t value) -> std::optional<std::uint64_t>
+    {
+        return appender.append(&value, sizeof(value));
+    }
+
+    static auto readValue(Journal::Tailer& tailer) -> std::optional<std::uint64_t>
+    {
+        const auto record { tailer.read() };
+        if (!record || record->size != sizeof(std::uint64_t)) {
+            return std::nullopt;
+        }
+        std::uint64_t value {};
+        std::memcpy(&value, record->data, sizeof(value));
+        return value;
+    }
+
+    [[nodiscard]] auto cycleCount() const -> std::size_t
+    {
+        std::size_t count { 0 };
+        for (const auto& entry : std::filesystem::directory_iterator { directory }) {
+            count += entry.path().extension() == ".cycle" ? 1 : 0;
+        }
+        return count;
+    }
+
+    std::string directory;
+};
+
+TEST_F(JournalTest, AppendAndTail)
+{
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+    auto tailer { journal.makeTailer() };
+
+    EXPECT_FALSE(tailer.read().has_value());
+    EXPECT_EQ(appender->append("a", 1), 0);
+    EXPECT_EQ(appender->append("", 0), 1);
+    EXPECT_EQ(appender->append("a longer record", 15), 2);
+
+    auto record { tailer.read() };
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(record->data), record->size), "a");
+    EXPECT_EQ(record->index, 0);
+    record = tailer.read();
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->size, 0);
+    record = tailer.read();
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(record->data), record->size), "a longer record");
+    EXPECT_EQ(record->index, 2);
+    EXPECT_FALSE(tailer.read().has_value());
+}
+
+TEST_F(JournalTest, InPlaceReserveCommit)
+{
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+
+    std::byte* data { appender->reserve(64) };
+    ASSERT_NE(data, nullptr);
+    std::memcpy(data, "abc", 3);
+    EXPECT_EQ(appender->commit(3), 0);
+
+    auto tailer { journal.makeTailer() };
+    const auto record { tailer.read() };
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(record->data), record->size), "abc");
+}
+
+TEST_F(JournalTest, RecordSizeLimit)
+{
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+
+    const std::vector<std::byte> large(Journal::maxRecordSize() + 1);
+    EXPECT_FALSE(appender->append(large.data(), large.size()).has_value());
+    EXPECT_EQ(appender->append(large.data(), Journal::maxRecordSize()), 0);
+    EXPECT_EQ(appender->append(large.data(), Journal::maxRecordSize()), 1);
+    EXPECT_EQ(cycleCount(), 2);
+}
+
+TEST_F(JournalTest, RollsOverCycles)
+{
+    constexpr std::uint64_t count { 2000 };
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        EXPECT_EQ(append(*appender, i), i);
+    }
+    EXPECT_GT(cycleCount(), 1);
+
+    auto tailer { journal.makeTailer() };
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        EXPECT_EQ(tailer.index(), i);
+        EXPECT_EQ(readValue(tailer), i);
+    }
+    EXPECT_FALSE(tailer.read().has_value());
+}
+
+TEST_F(JournalTest, SeekToIndex)
+{
+    constexpr std::uint64_t count { 2000 };
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        append(*appender, i);
+    }
+
+    auto tailer { journal.makeTailer() };
+    for (const std::uint64_t index : { std::uint64_t { 1234 }, std::uint64_t { 0 }, count - 1, std::uint64_t { 700 } }) {
+        EXPECT_TRUE(tailer.seek(index));
+        EXPECT_EQ(readValue(tailer), index);
+    }
+
+    EXPECT_FALSE(tailer.seek(count + 10));
+    EXPECT_EQ(tailer.index(), count);
+    append(*appender, count);
+    EXPECT_EQ(readValue(tailer), count);
+
+    tailer.toEnd();
+    EXPECT_FALSE(tailer.read().has_value());
+}
+
+TEST_F(JournalTest, ResumesAfterReopen)
+{
+    constexpr std::uint64_t count { 1000 };
+    Journal journal { directory };
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        auto appender { journal.makeAppender() };
+        ASSERT_TRUE(appender.has_value());
+        EXPECT_EQ(appender->nextIndex(), i);
+        EXPECT_EQ(append(*appender, i), i);
+    }
+
+    auto tailer { journal.makeTailer() };
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        EXPECT_EQ(readValue(tailer), i);
+    }
+}
+
+TEST_F(JournalTest, RecoversFromUnpublishedFirstCycle)
+{
+    // A crash while creating the first cycle leaves a file whose header was never published.
+    const std::filesystem::path path { std::filesystem::path { directory } / "0000000000000000.cycle" };
+    std::ofstream { path };
+    std::filesystem::resize_file(path, fileSize);
+
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+    EXPECT_EQ(append(*appender, 7), 0);
+
+    auto tailer { journal.makeTailer() };
+    EXPECT_EQ(readValue(tailer), 7);
+    EXPECT_EQ(cycleCount(), 1);
+}
+
+TEST_F(JournalTest, KeepsCyclesWithAnotherLayout)
+{
+    {
+        Journal journal { directory };
+        auto appender { journal.makeAppender() };
+        ASSERT_TRUE(appender.has_value());
+        EXPECT_EQ(append(*appender, 7), 0);
+    }
+
+    // Opening with a different file size must fail rather than discard the committed record.
+    Blockbuster::Journal<fileSize * 2> other { directory };
+    EXPECT_FALSE(other.makeAppender().has_value());
+    EXPECT_EQ(cycleCount(), 1);
+
+    Journal journal { directory };
+    auto tailer { journal.makeTailer() };
+    EXPECT_EQ(readValue(tailer), 7);
+}
+
+TEST_F(JournalTest, SingleAppender)
+{
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+    EXPECT_FALSE(journal.makeAppender().has_value());
+}
+
+TEST_F(JournalTest, TailerFollowsAppender)
+{
+    constexpr std::uint64_t count { 100000 };
+    Journal journal { directory };
+    auto appender { journal.makeAppender() };
+    ASSERT_TRUE(appender.has_value());
+
+    std::thread producer { [&appender]() {
+        for (std::uint64_t i { 0 }; i < count; ++i) {
+            append(*appender, i);
+        }
+    } };
+
+    auto tailer { journal.makeTailer() };
+    for (std::uint64_t expected { 0 }; expected < count;) {
+        if (const auto value { readValue(tailer) }) {
+            EXPECT_EQ(*value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
@@ -0,0 +1,136 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "log/logger.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override { file = std::tmpfile(); }
+    void TearDown() override { std::fclose(file); }
+
+    // Returns the logged lines with their timestamp prefixes stripped.
+    auto lines() -> std::vector<std::string>
+    {
+        std::string contents {};
+        std::rewind(file);
+        std::array<char, 4096> chunk {};
+        std::size_t read {};
+        while ((read = std::fread(chunk.data(), 1, chunk.size(), file)) > 0) {
+            contents.append(chunk.data(), read);
+        }
+
+        std::vector<std::string> result {};
+        std::istringstream stream { contents };
+        for (std::string line {}; std::getline(stream, line);) {
+            result.push_back(line.substr(line.find(' ') + 1));
+        }
+        return result;
+    }
+
+    std::FILE* file {};
+};
+
+TEST_F(LoggerTest, FormatsArgumentsInBackground)
+{
+    Blockbuster::Log::Logger<> logger { file };
+    const std::string owned { "owned" };
+
+    EXPECT_TRUE(BLOCKBUSTER_LOG(logger, "plain message"));
+    EXPECT_TRUE(BLOCKBUSTER_LOG(logger, "int %d, double %.2f, char %c", 42, 3.14159, 'x'));
+    EXPECT_TRUE(BLOCKBUSTER_LOG(logger, "strings %s %s", "literal", owned));
+    logger.flush();
+
+    EXPECT_EQ(lines(),
+        (std::vector<std::string> { "plain message", "int 42, double 3.14, char x", "strings literal owned" }));
+}
+
+TEST_F(LoggerTest, TimestampsArePrefixed)
+{
+    Blockbuster::Log::Logger<> logger { file };
+    BLOCKBUSTER_LOG(logger, "hello");
+    logger.flush();
+
+    std::rewind(file);
+    unsigned long long seconds {}; // NOLINT(google-runtime-int)
+    unsigned long long nanoseconds {}; // NOLINT(google-runtime-int)
+    EXPECT_EQ(std::fscanf(file, "%llu.%llu", &seconds, &nanoseconds), 2);
+    EXPECT_LT(nanoseconds, 1000000000ULL);
+}
+
+TEST_F(LoggerTest, LongMessages)
+{
+    Blockbuster::Log::Logger<> logger { file };
+    const std::string longText(2000, 'z');
+    BLOCKBUSTER_LOG(logger, "[%s]", longText);
+    logger.flush();
+
+    EXPECT_EQ(lines(), (std::vector<std::string> { "[" + longText + "]" }));
+}
+
+TEST_F(LoggerTest, DropsWhenRingIsFull)
+{
+    Blockbuster::Log::Logger<256> logger { file, std::chrono::seconds { 10 } };
+    const std::string text(100, 'a');
+
+    std::size_t queued { 0 };
+    for (int i { 0 }; i < 10; ++i) {
+        queued += BLOCKBUSTER_LOG(logger, "%s", text) ? 1 : 0;
+    }
+
+    EXPECT_LT(queued, 10);
+    EXPECT_EQ(logger.droppedCount(), 10 - queued);
+}
+
+TEST_F(LoggerTest, ManyThreads)
+{
+    constexpr int numThreads { 4 };
+    constexpr int messagesPerThread { 10000 };
+
+    {
+        Blockbuster::Log::Logger<> logger { file };
+        std::vector<std::thread> threads {};
+        for (int t { 0 }; t < numThreads; ++t) {
+            threads.emplace_back([&logger, t]() {
+                for (int i { 0 }; i < messagesPerThread; ++i) {
+                    while (!BLOCKBUSTER_LOG(logger, "thread %d message %d", t, i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    const std::vector<std::string> logged { lines() };
+    EXPECT_EQ(logged.size(), static_cast<std::size_t>(numThreads * messagesPerThread));
+
+    std::vector<int> nextExpected(numThreads, 0);
+    for (const std::string& line : logged) {
+        int thread {};
+        int message {};
+        ASSERT_EQ(std::sscanf(line.c_str(), "thread %d message %d", &thread, &message), 2);
+        EXPECT_EQ(message, nextExpected[static_cast<std::size_t>(thread)]++);
+    }
+}
+
+TEST_F(LoggerTest, ShortLivedLoggersOnOneThread)
+{
+    // Each logger registers a ring for this thread, which must not outlive the logger.
+    constexpr int numLoggers { 100 };
+    for (int i { 0 }; i < numLoggers; ++i) {
+        Blockbuster::Log::Logger<> logger { file };
+        EXPECT_TRUE(BLOCKBUSTER_LOG(logger, "logger %d", i));
+    }
+
+    const std::vector<std::string> logged { lines() };
+    ASSERT_EQ(logged.size(), static_cast<std::size_t>(numLoggers));
+    EXPECT_EQ(logged.back(), "logger 99");
+}
@@ -0,0 +1,159 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpmc/channel.hpp"
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t channelCapacity { 4 };
+
+namespace {
+
+// A coroutine that starts eagerly and frees itself when it finishes.
+struct Detached {
+    struct promise_type {
+        auto get_return_object() -> Detached { return {}; }
+        auto initial_suspend() noexcept -> std::suspend_never { return {}; }
+        auto final_suspend() noexcept -> std::suspend_never { return {}; }
+        void return_void() { }
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// Collects resumed coroutines so that the test decides where they run.
+struct QueuedExecutor {
+    void operator()(std::coroutine_handle<> handle) const { ready->push_back(handle); }
+
+    std::deque<std::coroutine_handle<>>* ready;
+};
+
+template <typename Channel>
+auto receiveInto(Channel& channel, std::vector<int>& received) -> Detached
+{
+    received.push_back(co_await channel.receive());
+}
+
+template <typename Channel>
+auto sendAll(Channel& channel, int first, int count, std::atomic<bool>& done) -> Detached
+{
+    for (int i { first }; i < first + count; ++i) {
+        co_await channel.send(i);
+    }
+    done.store(true);
+}
+
+} // namespace
+
+class MpmcChannelTest : public ::testing::Test {
+protected:
+    Blockbuster::Mpmc::Channel<int, channelCapacity> channel;
+};
+
+TEST_F(MpmcChannelTest, CompletesSynchronously)
+{
+    std::atomic<bool> done { false };
+    sendAll(channel, 0, static_cast<int>(channelCapacity), done);
+    EXPECT_TRUE(done);
+    EXPECT_EQ(channel.size(), channelCapacity);
+
+    std::vector<int> received {};
+    for (std::size_t i { 0 }; i < channelCapacity; ++i) {
+        receiveInto(channel, received);
+    }
+    EXPECT_EQ(received, (std::vector<int> { 0, 1, 2, 3 }));
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST_F(MpmcChannelTest, ReceiverSuspendsUntilSend)
+{
+    std::vector<int> received {};
+    receiveInto(channel, received);
+    receiveInto(channel, received);
+    EXPECT_TRUE(received.empty());
+
+    EXPECT_TRUE(channel.trySend(7));
+    EXPECT_EQ(received, (std::vector<int> { 7 }));
+    EXPECT_TRUE(channel.trySend(8));
+    EXPECT_EQ(received, (std::vector<int> { 7, 8 }));
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST_F(MpmcChannelTest, SenderSuspendsWhileFull)
+{
+    std::atomic<bool> done { false };
+    sendAll(channel, 0, static_cast<int>(channelCapacity) + 2, done);
+    EXPECT_FALSE(done);
+    EXPECT_FALSE(channel.trySend(-1));
+
+    for (int expected { 0 }; expected < static_cast<int>(channelCapacity) + 2; ++expected) {
+        EXPECT_EQ(channel.tryReceive(), expected);
+    }
+    EXPECT_TRUE(done);
+    EXPECT_FALSE(channel.tryReceive().has_value());
+}
+
+TEST(MpmcChannelExecutorTest, ResumesOnExecutor)
+{
+    std::deque<std::coroutine_handle<>> ready {};
+    Blockbuster::Mpmc::Channel<int, channelCapacity, QueuedExecutor> channel { QueuedExecutor { &ready } };
+
+    std::vector<int> received {};
+    receiveInto(channel, received);
+    EXPECT_TRUE(channel.trySend(1));
+    EXPECT_TRUE(received.empty());
+    ASSERT_EQ(ready.size(), 1);
+
+    ready.front().resume();
+    ready.pop_front();
+    EXPECT_EQ(received, (std::vector<int> { 1 }));
+}
+
+TEST(MpmcChannelConcurrentTest, ProducersAndConsumers)
+{
+    constexpr int producerCount { 4 };
+    constexpr int consumerCount { 4 };
+    constexpr int itemsPerProducer { 20000 };
+    Blockbuster::Mpmc::Channel<int, channelCapacity> channel {};
+    std::atomic<long> sum { 0 };
+    std::atomic<int> finished { 0 };
+
+    auto consume = [&]() -> Detached {
+        for (int i { 0 }; i < itemsPerProducer * producerCount / consumerCount; ++i) {
+            sum.fetch_add(co_await channel.receive(), std::memory_order_relaxed);
+        }
+        finished.fetch_add(1);
+    };
+    auto produce = [&](int first) -> Detached {
+        for (int i { first }; i < first + itemsPerProducer; ++i) {
+            co_await channel.send(i);
+        }
+        finished.fetch_add(1);
+    };
+
+    // Each thread only starts its coroutine; whichever thread completes a suspended operation resumes it.
+    std::vector<std::thread> threads {};
+    for (int c { 0 }; c < consumerCount; ++c) {
+        threads.emplace_back([&]() { consume(); });
+    }
+    for (int p { 0 }; p < producerCount; ++p) {
+        threads.emplace_back([&, p]() { produce(p * itemsPerProducer); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto deadline { std::chrono::steady_clock::now() + std::chrono::seconds { 30 } };
+    while (finished.load() < producerCount + consumerCount && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(finished.load(), producerCount + consumerCount);
+
+    const long total { static_cast<long>(producerCount) * itemsPerProducer };
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+}
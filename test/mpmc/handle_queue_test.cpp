@@ -0,0 +1,130 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpmc/handle_queue.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+struct LargeMessage {
+    int id {};
+    std::array<char, 1024> body {};
+};
+
+} // namespace
+
+constexpr std::size_t handleQueueCapacity { 16 };
+
+class MpmcHandleQueueTest : public ::testing::Test {
+protected:
+    Blockbuster::Mpmc::HandleQueue<LargeMessage, handleQueueCapacity> queue;
+};
+
+TEST_F(MpmcHandleQueueTest, ClaimPublishConsumeRelease)
+{
+    auto handle { queue.claim() };
+    ASSERT_TRUE(handle.has_value());
+    queue.get(*handle).id = 7;
+    queue.get(*handle).body.fill('x');
+    EXPECT_TRUE(queue.empty());
+
+    queue.publish(*handle);
+    EXPECT_EQ(queue.size(), 1);
+
+    auto consumed { queue.consume() };
+    ASSERT_TRUE(consumed.has_value());
+    EXPECT_EQ(*consumed, *handle);
+    EXPECT_EQ(queue.get(*consumed).id, 7);
+    EXPECT_EQ(queue.get(*consumed).body.back(), 'x');
+    queue.release(*consumed);
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.consume().has_value());
+}
+
+TEST_F(MpmcHandleQueueTest, EnqueueDequeueAndFull)
+{
+    for (std::size_t i { 0 }; i < handleQueueCapacity; ++i) {
+        EXPECT_TRUE(queue.enqueue(LargeMessage { static_cast<int>(i), {} }));
+    }
+    EXPECT_FALSE(queue.enqueue(LargeMessage {}));
+    EXPECT_FALSE(queue.claim().has_value());
+
+    for (std::size_t i { 0 }; i < handleQueueCapacity; ++i) {
+        auto value { queue.dequeue() };
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value->id, static_cast<int>(i));
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST_F(MpmcHandleQueueTest, RingIsSmallerThanInlineQueue)
+{
+    EXPECT_LT(sizeof(Blockbuster::Mpmc::Queue<Blockbuster::Mpmc::HandleQueue<LargeMessage, 16>::Handle, 16>),
+        sizeof(Blockbuster::Mpmc::Queue<LargeMessage, 16>));
+}
+
+TEST_F(MpmcHandleQueueTest, MultipleProducersAndConsumers)
+{
+    constexpr int numProducers { 4 };
+    constexpr int numConsumers { 4 };
+    constexpr int iterationsPerThread { 50000 };
+    constexpr int totalIterations { numProducers * iterationsPerThread };
+
+    std::atomic<int> consumedCount { 0 };
+    std::vector<int> consumedValues(static_cast<std::size_t>(totalIterations), -1);
+
+    std::vector<std::thread> producers {};
+    std::vector<std::thread> consumers {};
+
+    for (int p { 0 }; p < numProducers; ++p) {
+        producers.emplace_back([this, p]() {
+            for (int i { 0 }; i < iterationsPerThread; ++i) {
+                std::optional<std::uint32_t> handle {};
+                while (!(handle = queue.claim())) {
+                    std::this_thread::yield();
+                }
+                LargeMessage& message { queue.get(*handle) };
+                message.id = p * iterationsPerThread + i;
+                message.body.front() = static_cast<char>(message.id);
+                message.body.back() = static_cast<char>(message.id);
+                queue.publish(*handle);
+            }
+        });
+    }
+
+    for (int c { 0 }; c < numConsumers; ++c) {
+        consumers.emplace_back([this, &consumedCount, &consumedValues]() {
+            while (consumedCount.load(std::memory_order_relaxed) < totalIterations) {
+                std::optional<std::uint32_t> handle { queue.consume() };
+                if (handle) {
+                    const LargeMessage& message { queue.get(*handle) };
+                    const int index { consumedCount.fetch_add(1, std::memory_order_relaxed) };
+                    consumedValues[static_cast<std::size_t>(index)]
+                        = message.body.front() == message.body.back() ? message.id : -2;
+                    queue.release(*handle);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& p : producers) {
+        p.join();
+    }
+    for (auto& c : consumers) {
+        c.join();
+    }
+
+    EXPECT_TRUE(queue.empty());
+    std::sort(consumedValues.begin(), consumedValues.end());
+    for (int i { 0 }; i < totalIterations; ++i) {
+        EXPECT_EQ(consumedValues[static_cast<std::size_t>(i)], i);
+    }
+}
@@ -1,10 +1,13 @@
 // NOLINTBEGIN(llvm-include-order)
 #include "mpmc/queue.hpp"
+#include "stats.hpp"
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 // NOLINTEND(llvm-include-order)
 
 constexpr std::size_t capacity { 16 };
@@ -142,3 +145,70 @@ TEST_F(MpmcQueueTest, MultipleProducersAndConsumers)
         EXPECT_EQ(consumedValues[i], i);
     }
 }
+
+TEST(MpmcQueueStatsTest, CountsOutcomes)
+{
+    Blockbuster::Mpmc::Queue<int, 4, Blockbuster::QueueStats<>> queue {};
+    EXPECT_FALSE(queue.dequeue().has_value());
+    for (int i { 0 }; i < 4; ++i) {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+    EXPECT_FALSE(queue.enqueue(4));
+    EXPECT_TRUE(queue.dequeue().has_value());
+
+    const Blockbuster::QueueStatsSnapshot stats { queue.stats().snapshot() };
+    EXPECT_EQ(stats.enqueued, 4);
+    EXPECT_EQ(stats.enqueueFull, 1);
+    EXPECT_EQ(stats.dequeued, 1);
+    EXPECT_EQ(stats.dequeueEmpty, 1);
+    EXPECT_EQ(stats.maxDepth, 4);
+}
+
+TEST(MpmcQueueStatsTest, CountsAcrossThreads)
+{
+    constexpr int statsThreads { 4 };
+    constexpr int statsIterations { 100000 };
+    Blockbuster::Mpmc::Queue<int, 64, Blockbuster::QueueStats<>> queue {};
+
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < statsThreads; ++t) {
+        threads.emplace_back([&queue]() {
+            for (int i { 0 }; i < statsIterations; ++i) {
+                while (!queue.enqueue(i)) {
+                    std::this_thread::yield();
+                }
+                while (!queue.dequeue()) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const Blockbuster::QueueStatsSnapshot stats { queue.stats().snapshot() };
+    EXPECT_EQ(stats.enqueued, statsThreads * statsIterations);
+    EXPECT_EQ(stats.dequeued, statsThreads * statsIterations);
+    EXPECT_LE(stats.maxDepth, statsThreads);
+    EXPECT_GE(stats.maxDepth, 1);
+}
+
+TEST(MpmcQueueStatsTest, MeasuresQueueingLatency)
+{
+    Blockbuster::Mpmc::Queue<int, 4, Blockbuster::LatencyStats<4>> queue {};
+    EXPECT_EQ(queue.stats().latency().count(), 0);
+
+    EXPECT_TRUE(queue.enqueue(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+    EXPECT_TRUE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.enqueue(2));
+    EXPECT_TRUE(queue.dequeue().has_value());
+
+    EXPECT_EQ(queue.stats().snapshot().dequeued, 2);
+    const auto latency { queue.stats().latency() };
+    EXPECT_EQ(latency.count(), 2);
+    EXPECT_LT(latency.percentile(50), 2000000);
+    EXPECT_GE(latency.percentile(100), 2000000);
+    EXPECT_EQ(latency.percentile(100), latency.max());
+}
@@ -0,0 +1,200 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpmc/shared_queue.hpp"
+#include "spsc/shared_queue.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t sharedCapacity { 64 };
+constexpr std::uint64_t itemsPerProducer { 50000 };
+
+using SharedQueue = Blockbuster::Mpmc::SharedQueue<std::uint64_t, sharedCapacity>;
+
+class MpmcSharedQueueTest : public ::testing::Test {
+protected:
+    void TearDown() override { SharedQueue::unlink(name.c_str()); }
+
+    static auto exitedCleanly(pid_t child) -> bool
+    {
+        int status { 0 };
+        return waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    std::string name { "/blockbuster_test_" + std::to_string(getpid()) };
+};
+
+TEST_F(MpmcSharedQueueTest, SeparateMappingsShareState)
+{
+    auto producer { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(producer.has_value());
+    auto consumer { SharedQueue::attach(name.c_str()) };
+    ASSERT_TRUE(consumer.has_value());
+
+    EXPECT_TRUE(producer->enqueue(1));
+    EXPECT_TRUE(producer->enqueue(2));
+    EXPECT_EQ(consumer->size(), 2);
+    EXPECT_EQ(consumer->dequeue(), 1);
+    EXPECT_EQ(consumer->dequeue(), 2);
+    EXPECT_FALSE(consumer->dequeue().has_value());
+    EXPECT_TRUE(consumer->empty());
+}
+
+TEST_F(MpmcSharedQueueTest, FullQueue)
+{
+    auto queue { SharedQueue::createAnonymous() };
+    ASSERT_TRUE(queue.has_value());
+
+    for (std::uint64_t i { 0 }; i < sharedCapacity; ++i) {
+        EXPECT_TRUE(queue->enqueue(i));
+    }
+    EXPECT_FALSE(queue->enqueue(sharedCapacity));
+}
+
+TEST_F(MpmcSharedQueueTest, AttachValidatesLayout)
+{
+    auto queue { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(queue.has_value());
+    EXPECT_FALSE((Blockbuster::Mpmc::SharedQueue<std::uint32_t, sharedCapacity>::attach(name.c_str()).has_value()));
+    EXPECT_FALSE((Blockbuster::Spsc::SharedQueue<std::uint64_t, sharedCapacity>::attach(name.c_str()).has_value()));
+}
+
+TEST_F(MpmcSharedQueueTest, RecoverIgnoresLiveProcesses)
+{
+    auto queue { SharedQueue::createAnonymous() };
+    ASSERT_TRUE(queue.has_value());
+
+    EXPECT_TRUE(queue->enqueue(1));
+    EXPECT_EQ(queue->recover(), 0);
+    EXPECT_EQ(queue->dequeue(), 1);
+}
+
+TEST_F(MpmcSharedQueueTest, ContendingThreadsNeverFail)
+{
+    // Threads of one process share an owner stamp, so contending on a cell must not look like a held cell.
+    constexpr int threadCount { 4 };
+    constexpr std::uint64_t itemsPerThread { 8192 };
+    using LargeQueue = Blockbuster::Mpmc::SharedQueue<std::uint64_t, threadCount * itemsPerThread>;
+    auto queue { LargeQueue::createAnonymous() };
+    ASSERT_TRUE(queue.has_value());
+
+    std::atomic<int> failures { 0 };
+    const auto run { [&failures](auto operation) {
+        std::vector<std::thread> threads {};
+        for (int t { 0 }; t < threadCount; ++t) {
+            threads.emplace_back([&failures, operation]() {
+                for (std::uint64_t i { 0 }; i < itemsPerThread; ++i) {
+                    failures.fetch_add(operation(i) ? 0 : 1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    } };
+
+    run([&queue](std::uint64_t i) { return queue->enqueue(i); });
+    EXPECT_EQ(failures.load(), 0);
+    run([&queue](std::uint64_t /*i*/) { return queue->dequeue().has_value(); });
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(MpmcSharedQueueTest, ProducerProcesses)
+{
+    constexpr int producers { 2 };
+    auto queue { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(queue.has_value());
+
+    std::array<pid_t, producers> children {};
+    for (int p { 0 }; p < producers; ++p) {
+        children[p] = fork();
+        ASSERT_NE(children[p], -1);
+        if (children[p] == 0) {
+            auto producer { SharedQueue::attach(name.c_str()) };
+            if (!producer) {
+                _exit(2);
+            }
+            for (std::uint64_t i { 0 }; i < itemsPerProducer; ++i) {
+                while (!producer->enqueue((static_cast<std::uint64_t>(p) << 32) | i)) {
+                    std::this_thread::yield();
+                }
+            }
+            _exit(0);
+        }
+    }
+
+    // Each producer's items must arrive in order.
+    std::array<std::uint64_t, producers> next {};
+    for (std::uint64_t received { 0 }; received < producers * itemsPerProducer;) {
+        if (auto item { queue->dequeue() }) {
+            const auto producer { static_cast<std::size_t>(*item >> 32) };
+            ASSERT_LT(producer, producers);
+            EXPECT_EQ(*item & 0xFFFFFFFF, next[producer]++);
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (const pid_t child : children) {
+        EXPECT_TRUE(exitedCleanly(child));
+    }
+}
+
+TEST_F(MpmcSharedQueueTest, RecoversFromKilledProducers)
+{
+    // Large elements make it likely that a producer is killed part-way through writing one.
+    using Payload = std::array<std::uint64_t, 1U << 17>;
+    using LargeQueue = Blockbuster::Mpmc::SharedQueue<Payload, 2>;
+    auto queue { LargeQueue::createAnonymous() };
+    ASSERT_TRUE(queue.has_value());
+
+    std::size_t repaired { 0 };
+    for (int round { 0 }; round < 10; ++round) {
+        const pid_t child { fork() };
+        ASSERT_NE(child, -1);
+        if (child == 0) {
+            static Payload payload {};
+            for (std::uint64_t i { 1 };; ++i) {
+                payload.front() = i;
+                payload.back() = i;
+                while (!queue->enqueue(payload)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds { 200 + round * 50 });
+        kill(child, SIGKILL);
+        waitpid(child, nullptr, 0);
+        repaired += queue->recover(child);
+
+        // Whatever the child left behind, the queue must drain completely without exposing torn elements.
+        while (auto item { queue->dequeue() }) {
+            EXPECT_EQ(item->front(), item->back());
+        }
+        EXPECT_TRUE(queue->empty());
+    }
+    EXPECT_EQ(queue->abandonedCount(), repaired);
+
+    auto payload { std::make_unique<Payload>() };
+    for (std::uint64_t i { 0 }; i < queue->capacity(); ++i) {
+        payload->front() = i;
+        EXPECT_TRUE(queue->enqueue(*payload));
+    }
+    for (std::uint64_t i { 0 }; i < queue->capacity(); ++i) {
+        EXPECT_EQ(queue->dequeue()->front(), i);
+    }
+}
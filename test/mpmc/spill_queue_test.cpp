@@ -0,0 +1,160 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpmc/spill_queue.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t ringCapacity { 16 };
+constexpr std::size_t spillCapacity { 1024 };
+
+class MpmcSpillQueueTest : public ::testing::Test {
+protected:
+    Blockbuster::Mpmc::SpillQueue<std::uint64_t, ringCapacity, spillCapacity> queue { std::filesystem::temp_directory_path().string() };
+};
+
+TEST_F(MpmcSpillQueueTest, StaysInMemoryBelowHighWaterMark)
+{
+    for (std::uint64_t i { 0 }; i < 8; ++i) {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+    EXPECT_EQ(queue.spilledCount(), 0);
+    for (std::uint64_t i { 0 }; i < 8; ++i) {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST_F(MpmcSpillQueueTest, SpillsAndPreservesOrder)
+{
+    constexpr std::uint64_t count { 500 };
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+    EXPECT_GT(queue.spilledCount(), 0);
+    EXPECT_EQ(queue.size(), count);
+
+    // Interleave enqueues while the spill file drains; they must queue up behind the spilled items.
+    for (std::uint64_t i { 0 }; i < count; ++i) {
+        EXPECT_EQ(queue.dequeue(), i);
+        if (i % 2 == 0) {
+            EXPECT_TRUE(queue.enqueue(count + i / 2));
+        }
+    }
+    for (std::uint64_t i { 0 }; i < count / 2; ++i) {
+        EXPECT_EQ(queue.dequeue(), count + i);
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.spilledCount(), 0);
+}
+
+TEST(MpmcSpillQueueEdgeTest, HighWaterMarkIsClamped)
+{
+    for (const std::size_t highWaterMark : { std::size_t { 0 }, ringCapacity * 2 }) {
+        Blockbuster::Mpmc::SpillQueue<std::uint64_t, ringCapacity, spillCapacity> queue {
+            std::filesystem::temp_directory_path().string(), highWaterMark
+        };
+        constexpr std::uint64_t count { ringCapacity * 4 };
+        for (std::uint64_t i { 0 }; i < count; ++i) {
+            EXPECT_TRUE(queue.enqueue(i));
+        }
+        EXPECT_GT(queue.spilledCount(), 0);
+        for (std::uint64_t i { 0 }; i < count; ++i) {
+            EXPECT_EQ(queue.dequeue(), i);
+        }
+        EXPECT_FALSE(queue.dequeue().has_value());
+    }
+}
+
+TEST_F(MpmcSpillQueueTest, FullQueue)
+{
+    std::uint64_t accepted { 0 };
+    while (queue.enqueue(accepted)) {
+        ++accepted;
+    }
+    EXPECT_GE(accepted, spillCapacity);
+    EXPECT_LE(accepted, queue.capacity());
+
+    for (std::uint64_t i { 0 }; i < accepted; ++i) {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+}
+
+TEST_F(MpmcSpillQueueTest, ConcurrentProducersKeepTheirOrder)
+{
+    constexpr int producers { 3 };
+    constexpr std::uint64_t itemsPerProducer { 20000 };
+
+    std::vector<std::thread> threads {};
+    for (int p { 0 }; p < producers; ++p) {
+        threads.emplace_back([this, p]() {
+            for (std::uint64_t i { 0 }; i < itemsPerProducer; ++i) {
+                while (!queue.enqueue((static_cast<std::uint64_t>(p) << 32) | i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<std::uint64_t, producers> next {};
+    for (std::uint64_t received { 0 }; received < producers * itemsPerProducer;) {
+        if (auto item { queue.dequeue() }) {
+            const auto producer { static_cast<std::size_t>(*item >> 32) };
+            ASSERT_LT(producer, producers);
+            EXPECT_EQ(*item & 0xFFFFFFFF, next[producer]++);
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_F(MpmcSpillQueueTest, ConcurrentProducersAndConsumers)
+{
+    constexpr int producers { 3 };
+    constexpr int consumers { 3 };
+    constexpr std::uint64_t itemsPerProducer { 20000 };
+    constexpr std::uint64_t total { producers * itemsPerProducer };
+
+    std::atomic<std::uint64_t> received { 0 };
+    std::atomic<std::uint64_t> sum { 0 };
+    std::vector<std::thread> threads {};
+    for (int p { 0 }; p < producers; ++p) {
+        threads.emplace_back([this, p]() {
+            for (std::uint64_t i { 0 }; i < itemsPerProducer; ++i) {
+                while (!queue.enqueue(static_cast<std::uint64_t>(p) * itemsPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c { 0 }; c < consumers; ++c) {
+        threads.emplace_back([this, &received, &sum]() {
+            while (received.load(std::memory_order_relaxed) < total) {
+                if (auto item { queue.dequeue() }) {
+                    sum.fetch_add(*item, std::memory_order_relaxed);
+                    received.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,135 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpsc/byte_queue.hpp"
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t byteCapacity { 256 };
+
+class MpscByteQueueTest : public ::testing::Test {
+protected:
+    auto enqueueString(const std::string& text) -> bool { return queue.enqueue(text.data(), text.size()); }
+
+    auto drain(std::size_t limit = 1000) -> std::vector<std::string>
+    {
+        std::vector<std::string> records {};
+        queue.consume(
+            [&records](const std::byte* data, std::size_t size) {
+                records.emplace_back(reinterpret_cast<const char*>(data), size);
+            },
+            limit);
+        return records;
+    }
+
+    Blockbuster::Mpsc::ByteQueue<byteCapacity> queue;
+};
+
+TEST_F(MpscByteQueueTest, VariableLengthRecords)
+{
+    EXPECT_TRUE(enqueueString("first"));
+    EXPECT_TRUE(enqueueString(""));
+    EXPECT_TRUE(enqueueString("a somewhat longer third record"));
+
+    EXPECT_EQ(drain(), (std::vector<std::string> { "first", "", "a somewhat longer third record" }));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(drain().empty());
+}
+
+TEST_F(MpscByteQueueTest, ConsumerStopsAtUncommittedRecord)
+{
+    EXPECT_TRUE(enqueueString("before"));
+    auto open { queue.reserve(16) };
+    ASSERT_TRUE(open.has_value());
+    EXPECT_TRUE(enqueueString("after"));
+
+    EXPECT_EQ(drain(), (std::vector<std::string> { "before" }));
+
+    std::memcpy(open->data, "open", 4);
+    queue.commit(*open, 4);
+    EXPECT_EQ(drain(), (std::vector<std::string> { "open", "after" }));
+}
+
+TEST_F(MpscByteQueueTest, LimitAndFull)
+{
+    const std::string record(queue.maxRecordSize(), 'x');
+    EXPECT_TRUE(enqueueString(record));
+    EXPECT_TRUE(enqueueString(record));
+    EXPECT_FALSE(enqueueString(""));
+    EXPECT_FALSE(queue.reserve(queue.maxRecordSize() + 1).has_value());
+
+    EXPECT_EQ(drain(1).size(), 1);
+    EXPECT_TRUE(enqueueString("y"));
+    EXPECT_EQ(drain(), (std::vector<std::string> { record, "y" }));
+    EXPECT_EQ(queue.usedBytes(), 0);
+}
+
+TEST_F(MpscByteQueueTest, FullBufferConsumedInOnePass)
+{
+    const std::string record(queue.maxRecordSize(), 'x');
+    EXPECT_TRUE(enqueueString(record));
+    EXPECT_TRUE(enqueueString(record));
+    EXPECT_EQ(queue.usedBytes(), queue.capacity());
+
+    EXPECT_EQ(drain().size(), 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(MpscByteQueueTest, RecordsStayContiguousAcrossWrap)
+{
+    for (int i { 0 }; i < 1000; ++i) {
+        const std::string first(static_cast<std::size_t>(i % 50), static_cast<char>('a' + i % 26));
+        const std::string second(static_cast<std::size_t>(i % 71), static_cast<char>('A' + i % 26));
+        ASSERT_TRUE(enqueueString(first));
+        ASSERT_TRUE(enqueueString(second));
+        EXPECT_EQ(drain(), (std::vector<std::string> { first, second }));
+    }
+}
+
+TEST_F(MpscByteQueueTest, MultipleProducersSingleConsumer)
+{
+    constexpr int numProducers { 4 };
+    constexpr int iterationsPerThread { 50000 };
+    constexpr int totalIterations { numProducers * iterationsPerThread };
+
+    std::vector<std::thread> producers {};
+    for (int p { 0 }; p < numProducers; ++p) {
+        producers.emplace_back([this, p]() {
+            for (int i { 0 }; i < iterationsPerThread; ++i) {
+                const std::string text(std::to_string(p) + ":" + std::to_string(i) + std::string(static_cast<std::size_t>(i % 23), '.'));
+                while (!enqueueString(text)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextExpected(numProducers, 0);
+    int consumed { 0 };
+    int outOfOrder { 0 };
+    while (consumed < totalIterations) {
+        const std::size_t count { queue.consume([&](const std::byte* data, std::size_t size) {
+            const std::string text(reinterpret_cast<const char*>(data), size);
+            const std::size_t colon { text.find(':') };
+            const int producer { std::stoi(text.substr(0, colon)) };
+            const int index { std::stoi(text.substr(colon + 1)) };
+            if (index != nextExpected[static_cast<std::size_t>(producer)]++) {
+                ++outOfOrder;
+            }
+        }) };
+        consumed += static_cast<int>(count);
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& p : producers) {
+        p.join();
+    }
+
+    EXPECT_EQ(outOfOrder, 0);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,101 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpsc/conflating_queue.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <utility>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t keyCapacity { 64 };
+
+class MpscConflatingQueueTest : public ::testing::Test {
+protected:
+    Blockbuster::Mpsc::ConflatingQueue<std::uint32_t, std::uint64_t, keyCapacity> queue;
+};
+
+TEST_F(MpscConflatingQueueTest, KeepsLatestValuePerKey)
+{
+    EXPECT_TRUE(queue.enqueue(1, 10));
+    EXPECT_TRUE(queue.enqueue(2, 20));
+    EXPECT_TRUE(queue.enqueue(1, 11));
+    EXPECT_TRUE(queue.enqueue(1, 12));
+    EXPECT_EQ(queue.size(), 2);
+
+    EXPECT_EQ(queue.dequeue(), (std::pair<std::uint32_t, std::uint64_t> { 1, 12 }));
+    EXPECT_EQ(queue.dequeue(), (std::pair<std::uint32_t, std::uint64_t> { 2, 20 }));
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(MpscConflatingQueueTest, KeyIsQueuedAgainAfterDequeue)
+{
+    EXPECT_TRUE(queue.enqueue(7, 1));
+    EXPECT_EQ(queue.dequeue()->second, 1);
+    EXPECT_TRUE(queue.enqueue(7, 2));
+    EXPECT_EQ(queue.dequeue()->second, 2);
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST_F(MpscConflatingQueueTest, RejectsNewKeysWhenFull)
+{
+    for (std::uint32_t key { 0 }; key < keyCapacity; ++key) {
+        EXPECT_TRUE(queue.enqueue(key, key));
+    }
+    EXPECT_FALSE(queue.enqueue(keyCapacity, 0));
+    EXPECT_TRUE(queue.enqueue(0, 100));
+
+    for (std::uint32_t key { 0 }; key < keyCapacity; ++key) {
+        const auto entry { queue.dequeue() };
+        ASSERT_TRUE(entry.has_value());
+        EXPECT_EQ(entry->second, entry->first == 0 ? 100 : entry->first);
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST(MpscConflatingQueueConcurrencyTest, ConsumerSeesLatestUntornValues)
+{
+    struct Quote {
+        std::uint64_t bid;
+        std::uint64_t ask;
+    };
+    constexpr int producers { 2 };
+    constexpr std::uint32_t keys { 32 };
+    constexpr std::uint64_t updates { 20000 };
+    Blockbuster::Mpsc::ConflatingQueue<std::uint32_t, Quote, 64> queue {};
+
+    // Each producer owns the keys congruent to its index, and publishes increasing values for them.
+    std::vector<std::thread> threads {};
+    for (int p { 0 }; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (std::uint64_t update { 1 }; update <= updates; ++update) {
+                for (std::uint32_t key { static_cast<std::uint32_t>(p) }; key < keys; key += producers) {
+                    EXPECT_TRUE(queue.enqueue(key, { update, update + 1 }));
+                }
+            }
+        });
+    }
+
+    std::array<std::uint64_t, keys> latest {};
+    std::uint32_t finished { 0 };
+    while (finished < keys) {
+        if (const auto entry { queue.dequeue() }) {
+            const auto& [key, quote] { *entry };
+            ASSERT_LT(key, keys);
+            EXPECT_EQ(quote.ask, quote.bid + 1);
+            EXPECT_GE(quote.bid, latest[key]);
+            if (quote.bid == updates && latest[key] != updates) {
+                ++finished;
+            }
+            latest[key] = quote.bid;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
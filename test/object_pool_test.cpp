@@ -0,0 +1,184 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpmc/queue.hpp"
+#include "object_pool.hpp"
+#include "spsc/queue.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+struct Message {
+    std::array<int, 32> payload {};
+};
+
+} // namespace
+
+constexpr std::size_t capacity { 64 };
+constexpr std::size_t cacheSize { 8 };
+
+class ObjectPoolTest : public ::testing::Test {
+protected:
+    using Pool = Blockbuster::ObjectPool<Message, capacity, cacheSize>;
+
+    Pool pool;
+};
+
+TEST_F(ObjectPoolTest, AcquireUntilExhausted)
+{
+    std::vector<Message*> acquired {};
+    for (std::size_t i { 0 }; i < capacity; ++i) {
+        Message* message { pool.acquire() };
+        ASSERT_NE(message, nullptr);
+        acquired.push_back(message);
+    }
+    EXPECT_EQ(pool.acquire(), nullptr);
+    EXPECT_FALSE(pool.acquireHandle().has_value());
+
+    pool.release(acquired.back());
+    EXPECT_EQ(pool.acquire(), acquired.back());
+}
+
+TEST_F(ObjectPoolTest, HandlesAreDistinctAndResolve)
+{
+    std::vector<Pool::Handle> handles {};
+    for (std::size_t i { 0 }; i < capacity; ++i) {
+        auto handle { pool.acquireHandle() };
+        ASSERT_TRUE(handle.has_value());
+        EXPECT_LT(*handle, capacity);
+        EXPECT_EQ(pool.handleOf(&pool.get(*handle)), *handle);
+        handles.push_back(*handle);
+    }
+
+    std::sort(handles.begin(), handles.end());
+    EXPECT_EQ(std::adjacent_find(handles.begin(), handles.end()), handles.end());
+}
+
+TEST_F(ObjectPoolTest, SlotsAreCacheLineAligned)
+{
+    Message* first { pool.acquire() };
+    Message* second { pool.acquire() };
+    const auto distance { reinterpret_cast<std::uintptr_t>(first) - reinterpret_cast<std::uintptr_t>(second) };
+    EXPECT_EQ(distance % Blockbuster::cacheLineSize, 0);
+}
+
+TEST_F(ObjectPoolTest, CacheReturnsSlotsOnDestruction)
+{
+    {
+        auto cache { pool.makeCache() };
+        for (std::size_t i { 0 }; i < capacity; ++i) {
+            EXPECT_NE(cache.acquire(), nullptr);
+        }
+        EXPECT_EQ(cache.acquire(), nullptr);
+
+        for (std::size_t i { 0 }; i < capacity; ++i) {
+            cache.release(static_cast<Pool::Handle>(i));
+        }
+    }
+
+    for (std::size_t i { 0 }; i < capacity; ++i) {
+        EXPECT_NE(pool.acquire(), nullptr);
+    }
+    EXPECT_EQ(pool.acquire(), nullptr);
+}
+
+TEST_F(ObjectPoolTest, HandlesThroughSpscQueue)
+{
+    constexpr int iterations { 100000 };
+    Blockbuster::Spsc::Queue<Pool::Handle, capacity> queue {};
+
+    std::thread producer([this, &queue]() {
+        auto cache { pool.makeCache() };
+        for (int i { 0 }; i < iterations; ++i) {
+            std::optional<Pool::Handle> handle {};
+            while (!(handle = cache.acquireHandle())) {
+                std::this_thread::yield();
+            }
+            pool.get(*handle).payload.fill(i);
+            while (!queue.enqueue(*handle)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::thread consumer([this, &queue]() {
+        auto cache { pool.makeCache() };
+        for (int i { 0 }; i < iterations; ++i) {
+            std::optional<Pool::Handle> handle {};
+            while (!(handle = queue.dequeue())) {
+                std::this_thread::yield();
+            }
+            const Message& message { pool.get(*handle) };
+            EXPECT_EQ(message.payload.front(), i);
+            EXPECT_EQ(message.payload.back(), i);
+            cache.release(*handle);
+        }
+    });
+
+    producer.join();
+    consumer.join();
+}
+
+TEST_F(ObjectPoolTest, PointersThroughMpmcQueue)
+{
+    constexpr int numProducers { 4 };
+    constexpr int numConsumers { 4 };
+    constexpr int iterationsPerThread { 50000 };
+    constexpr int totalIterations { numProducers * iterationsPerThread };
+
+    Blockbuster::Mpmc::Queue<Message*, capacity> queue {};
+    std::atomic<int> consumedCount { 0 };
+    std::atomic<int> corrupted { 0 };
+
+    std::vector<std::thread> producers {};
+    std::vector<std::thread> consumers {};
+
+    for (int p { 0 }; p < numProducers; ++p) {
+        producers.emplace_back([this, p, &queue]() {
+            auto cache { pool.makeCache() };
+            for (int i { 0 }; i < iterationsPerThread; ++i) {
+                Message* message {};
+                while ((message = cache.acquire()) == nullptr) {
+                    std::this_thread::yield();
+                }
+                message->payload.fill(p * iterationsPerThread + i);
+                while (!queue.enqueue(message)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int c { 0 }; c < numConsumers; ++c) {
+        consumers.emplace_back([this, &queue, &consumedCount, &corrupted]() {
+            auto cache { pool.makeCache() };
+            while (consumedCount.load(std::memory_order_relaxed) < totalIterations) {
+                std::optional<Message*> message { queue.dequeue() };
+                if (message) {
+                    if ((*message)->payload.front() != (*message)->payload.back()) {
+                        corrupted.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    cache.release(*message);
+                    consumedCount.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& p : producers) {
+        p.join();
+    }
+    for (auto& c : consumers) {
+        c.join();
+    }
+
+    EXPECT_EQ(consumedCount.load(), totalIterations);
+    EXPECT_EQ(corrupted.load(), 0);
+}
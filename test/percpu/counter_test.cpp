@@ -0,0 +1,53 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "percpu/counter.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+class PerCpuCounterTest : public ::testing::Test {
+protected:
+    Blockbuster::PerCpu::Counter counter;
+};
+
+TEST_F(PerCpuCounterTest, UsesRestartableSequencesWhenEnabled)
+{
+#if BLOCKBUSTER_HAS_RSEQ
+    if (!Blockbuster::PerCpu::rseqAvailable()) {
+        GTEST_SKIP() << "restartable sequences are not registered in this environment";
+    }
+    EXPECT_LT(Blockbuster::PerCpu::currentCpu(), Blockbuster::PerCpu::cpuCount());
+#else
+    EXPECT_FALSE(Blockbuster::PerCpu::rseqAvailable());
+#endif
+}
+
+TEST_F(PerCpuCounterTest, AddAndSubtract)
+{
+    EXPECT_EQ(counter.sum(), 0);
+    counter.add();
+    counter.add(10);
+    counter.add(-4);
+    EXPECT_EQ(counter.sum(), 7);
+}
+
+TEST_F(PerCpuCounterTest, ConcurrentAddsAreExact)
+{
+    constexpr int counterThreads { 8 };
+    constexpr std::int64_t addsPerThread { 500000 };
+
+    // Far more threads than cores, so that critical sections are regularly preempted and restarted.
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < counterThreads; ++t) {
+        threads.emplace_back([this]() {
+            for (std::int64_t i { 0 }; i < addsPerThread; ++i) {
+                counter.add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.sum(), counterThreads * addsPerThread);
+}
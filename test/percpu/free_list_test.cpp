@@ -0,0 +1,74 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "percpu/free_list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+struct PooledNode : Blockbuster::PerCpu::FreeListNode {
+    std::atomic<int> holders { 0 };
+};
+
+class PerCpuFreeListTest : public ::testing::Test {
+protected:
+    Blockbuster::PerCpu::FreeList<PooledNode> list;
+};
+
+TEST_F(PerCpuFreeListTest, PushPopIsLifo)
+{
+    PooledNode first {};
+    PooledNode second {};
+    EXPECT_EQ(list.pop(), nullptr);
+    list.push(&first);
+    list.push(&second);
+    EXPECT_EQ(list.pop(), &second);
+    EXPECT_EQ(list.pop(), &first);
+    EXPECT_EQ(list.pop(), nullptr);
+}
+
+TEST_F(PerCpuFreeListTest, ConcurrentReuseNeverSharesNodes)
+{
+    constexpr int listThreads { 8 };
+    constexpr int rounds { 200000 };
+    constexpr std::size_t nodeCount { 64 };
+
+    std::vector<PooledNode> nodes(nodeCount);
+    for (auto& node : nodes) {
+        list.push(&node);
+    }
+
+    // A node handed out twice at once would be seen with two holders.
+    std::atomic<int> shared { 0 };
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < listThreads; ++t) {
+        threads.emplace_back([this, &shared]() {
+            for (int i { 0 }; i < rounds; ++i) {
+                PooledNode* node { list.pop() };
+                if (node == nullptr) {
+                    continue;
+                }
+                if (node->holders.fetch_add(1, std::memory_order_relaxed) != 0) {
+                    shared.fetch_add(1, std::memory_order_relaxed);
+                }
+                node->holders.fetch_sub(1, std::memory_order_relaxed);
+                list.push(node);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(shared.load(), 0);
+
+    // Other CPUs' stacks are out of reach, but the one this thread is on must hold each node at most once.
+    std::vector<PooledNode*> drained {};
+    while (PooledNode* node { list.pop() }) {
+        drained.push_back(node);
+    }
+    std::sort(drained.begin(), drained.end());
+    EXPECT_EQ(std::adjacent_find(drained.begin(), drained.end()), drained.end());
+    EXPECT_LE(drained.size(), nodeCount);
+}
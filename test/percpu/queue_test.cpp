@@ -0,0 +1,81 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "percpu/queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t shardCapacity { 16 };
+
+class PerCpuQueueTest : public ::testing::Test {
+protected:
+    Blockbuster::PerCpu::Queue<int, shardCapacity> queue;
+};
+
+TEST_F(PerCpuQueueTest, EnqueueDequeue)
+{
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.capacity(), shardCapacity * Blockbuster::PerCpu::cpuCount());
+    EXPECT_TRUE(queue.enqueue(1));
+    EXPECT_TRUE(queue.enqueue(2));
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_TRUE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.dequeue().has_value());
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST_F(PerCpuQueueTest, FillsEveryShard)
+{
+    for (std::size_t i { 0 }; i < queue.capacity(); ++i) {
+        EXPECT_TRUE(queue.enqueue(static_cast<int>(i)));
+    }
+    EXPECT_FALSE(queue.enqueue(-1));
+
+    std::vector<int> values {};
+    while (auto value { queue.dequeue() }) {
+        values.push_back(*value);
+    }
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values.size(), queue.capacity());
+    for (std::size_t i { 0 }; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], static_cast<int>(i));
+    }
+}
+
+TEST_F(PerCpuQueueTest, MultipleProducersAndConsumers)
+{
+    constexpr int queueThreads { 4 };
+    constexpr int itemsPerThread { 100000 };
+
+    std::atomic<long> consumedSum { 0 };
+    std::atomic<int> consumedCount { 0 };
+    std::vector<std::thread> threads {};
+    for (int t { 0 }; t < queueThreads; ++t) {
+        threads.emplace_back([this]() {
+            for (int i { 1 }; i <= itemsPerThread; ++i) {
+                while (!queue.enqueue(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([this, &consumedSum, &consumedCount]() {
+            while (consumedCount.load(std::memory_order_relaxed) < queueThreads * itemsPerThread) {
+                if (const auto value { queue.dequeue() }) {
+                    consumedSum.fetch_add(*value, std::memory_order_relaxed);
+                    consumedCount.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(consumedCount.load(), queueThreads * itemsPerThread);
+    EXPECT_EQ(consumedSum.load(), static_cast<long>(queueThreads) * itemsPerThread * (itemsPerThread + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,164 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "reclamation/epoch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+std::atomic<int> liveNodes { 0 };
+
+struct Node : Blockbuster::Reclamation::Retirable {
+    explicit Node(int v)
+        : value { v }
+    {
+        liveNodes.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~Node() { liveNodes.fetch_sub(1, std::memory_order_relaxed); }
+
+    Node(const Node&) = delete;
+    auto operator=(const Node&) -> Node& = delete;
+    Node(Node&&) = delete;
+    auto operator=(Node&&) -> Node& = delete;
+
+    int value;
+};
+
+} // namespace
+
+constexpr std::size_t collectThreshold { 8 };
+
+class EpochTest : public ::testing::Test {
+protected:
+    void SetUp() override { liveNodes.store(0, std::memory_order_relaxed); }
+
+    Blockbuster::Reclamation::EpochDomain domain { collectThreshold };
+};
+
+TEST_F(EpochTest, ReclaimsAfterTwoEpochs)
+{
+    auto participant { domain.makeParticipant() };
+    participant.retire(new Node { 1 });
+    EXPECT_EQ(participant.pendingCount(), 1);
+
+    participant.reclaim();
+    EXPECT_EQ(liveNodes.load(), 1);
+
+    participant.reclaim();
+    EXPECT_EQ(liveNodes.load(), 0);
+    EXPECT_EQ(participant.pendingCount(), 0);
+}
+
+TEST_F(EpochTest, PinnedReaderBlocksReclamation)
+{
+    auto reader { domain.makeParticipant() };
+    auto writer { domain.makeParticipant() };
+    std::atomic<Node*> shared { new Node { 42 } };
+
+    {
+        auto pin { reader.pin() };
+        const Node* node { shared.load() };
+
+        writer.retire(shared.exchange(nullptr));
+        for (int i { 0 }; i < 10; ++i) {
+            writer.reclaim();
+        }
+        EXPECT_EQ(liveNodes.load(), 1);
+        EXPECT_EQ(node->value, 42);
+    }
+
+    writer.reclaim();
+    writer.reclaim();
+    EXPECT_EQ(liveNodes.load(), 0);
+}
+
+TEST_F(EpochTest, NestedPins)
+{
+    auto participant { domain.makeParticipant() };
+    {
+        auto outer { participant.pin() };
+        {
+            auto inner { participant.pin() };
+            EXPECT_TRUE(participant.pinned());
+        }
+        EXPECT_TRUE(participant.pinned());
+    }
+    EXPECT_FALSE(participant.pinned());
+}
+
+TEST_F(EpochTest, RecordsAreReusedWithPendingGarbage)
+{
+    {
+        auto participant { domain.makeParticipant() };
+        participant.retire(new Node { 1 });
+    }
+    EXPECT_EQ(domain.pendingCount(), 1);
+
+    auto participant { domain.makeParticipant() };
+    EXPECT_EQ(participant.pendingCount(), 1);
+    participant.reclaim();
+    participant.reclaim();
+    EXPECT_EQ(liveNodes.load(), 0);
+}
+
+TEST_F(EpochTest, ConcurrentReadersAndWriters)
+{
+    constexpr int numReaders { 4 };
+    constexpr int numWriters { 2 };
+    constexpr int iterationsPerThread { 100000 };
+
+    std::atomic<Node*> shared { new Node { 0 } };
+    std::atomic<bool> done { false };
+    std::atomic<int> invalidReads { 0 };
+
+    std::vector<std::thread> readers {};
+    std::vector<std::thread> writers {};
+
+    for (int r { 0 }; r < numReaders; ++r) {
+        readers.emplace_back([this, &shared, &done, &invalidReads]() {
+            auto participant { domain.makeParticipant() };
+            while (!done.load(std::memory_order_relaxed)) {
+                {
+                    auto pin { participant.pin() };
+                    const Node* node { shared.load(std::memory_order_acquire) };
+                    if (node->value < 0 || node->value > numWriters * iterationsPerThread) {
+                        invalidReads.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                // Yield while unpinned, so that on few cores readers are rarely preempted inside a critical section
+                // (which would hold back the epoch for a whole time slice).
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int w { 0 }; w < numWriters; ++w) {
+        writers.emplace_back([this, w, &shared]() {
+            auto participant { domain.makeParticipant() };
+            for (int i { 1 }; i <= iterationsPerThread; ++i) {
+                participant.retire(shared.exchange(new Node { w * iterationsPerThread + i }));
+            }
+        });
+    }
+
+    for (auto& w : writers) {
+        w.join();
+    }
+    done.store(true, std::memory_order_relaxed);
+    for (auto& r : readers) {
+        r.join();
+    }
+
+    EXPECT_EQ(invalidReads.load(), 0);
+    EXPECT_LT(domain.pendingCount(), static_cast<std::size_t>(numWriters * iterationsPerThread));
+
+    auto participant { domain.makeParticipant() };
+    participant.retire(shared.exchange(nullptr));
+    for (int i { 0 }; i < 3; ++i) {
+        participant.reclaim();
+    }
+    EXPECT_EQ(participant.pendingCount(), 0);
+}
@@ -0,0 +1,163 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "reclamation/hazard_pointer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+namespace {
+
+std::atomic<int> liveNodes { 0 };
+
+struct Node : Blockbuster::Reclamation::Retirable {
+    explicit Node(int v)
+        : value { v }
+    {
+        liveNodes.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~Node() { liveNodes.fetch_sub(1, std::memory_order_relaxed); }
+
+    Node(const Node&) = delete;
+    auto operator=(const Node&) -> Node& = delete;
+    Node(Node&&) = delete;
+    auto operator=(Node&&) -> Node& = delete;
+
+    int value;
+};
+
+} // namespace
+
+constexpr std::size_t scanThreshold { 8 };
+
+class HazardPointerTest : public ::testing::Test {
+protected:
+    void SetUp() override { liveNodes.store(0, std::memory_order_relaxed); }
+
+    Blockbuster::Reclamation::HazardDomain domain { scanThreshold };
+};
+
+TEST_F(HazardPointerTest, UnprotectedObjectsAreReclaimed)
+{
+    domain.retire(new Node { 1 });
+    domain.retire(new Node { 2 });
+    EXPECT_EQ(domain.retiredCount(), 2);
+    EXPECT_EQ(liveNodes.load(), 2);
+
+    domain.reclaim();
+    EXPECT_EQ(domain.retiredCount(), 0);
+    EXPECT_EQ(liveNodes.load(), 0);
+}
+
+TEST_F(HazardPointerTest, ProtectedObjectSurvivesScan)
+{
+    std::atomic<Node*> shared { new Node { 42 } };
+    auto guard { domain.makeGuard() };
+
+    Node* protectedNode { guard.protect(shared) };
+    shared.store(nullptr);
+    domain.retire(protectedNode);
+
+    domain.reclaim();
+    EXPECT_EQ(liveNodes.load(), 1);
+    EXPECT_EQ(protectedNode->value, 42);
+
+    guard.clear();
+    domain.reclaim();
+    EXPECT_EQ(liveNodes.load(), 0);
+}
+
+TEST_F(HazardPointerTest, RecordsAreReused)
+{
+    {
+        auto first { domain.makeGuard() };
+        auto second { domain.makeGuard() };
+        EXPECT_EQ(domain.recordCount(), 2);
+    }
+
+    for (int i { 0 }; i < 10; ++i) {
+        auto guard { domain.makeGuard() };
+    }
+    EXPECT_EQ(domain.recordCount(), 2);
+}
+
+TEST_F(HazardPointerTest, ScanTriggersAtThreshold)
+{
+    for (int i { 1 }; i < static_cast<int>(scanThreshold); ++i) {
+        domain.retire(new Node { i });
+    }
+    EXPECT_EQ(domain.retiredCount(), scanThreshold - 1);
+    EXPECT_EQ(liveNodes.load(), scanThreshold - 1);
+
+    domain.retire(new Node { 0 });
+    EXPECT_EQ(domain.retiredCount(), 0);
+    EXPECT_EQ(liveNodes.load(), 0);
+}
+
+TEST_F(HazardPointerTest, GarbageIsBounded)
+{
+    std::atomic<Node*> shared { new Node { 0 } };
+    auto guard { domain.makeGuard() };
+    guard.protect(shared);
+
+    for (int i { 1 }; i < 1000; ++i) {
+        domain.retire(shared.exchange(new Node { i }));
+        EXPECT_LE(domain.retiredCount(), domain.garbageBound());
+    }
+
+    guard.clear();
+    domain.retire(shared.exchange(nullptr));
+    domain.reclaim();
+    EXPECT_EQ(liveNodes.load(), 0);
+}
+
+TEST_F(HazardPointerTest, ConcurrentReadersAndWriters)
+{
+    constexpr int numReaders { 4 };
+    constexpr int numWriters { 2 };
+    constexpr int iterationsPerThread { 100000 };
+
+    std::atomic<Node*> shared { new Node { 0 } };
+    std::atomic<bool> done { false };
+    std::atomic<int> invalidReads { 0 };
+
+    std::vector<std::thread> readers {};
+    std::vector<std::thread> writers {};
+
+    for (int r { 0 }; r < numReaders; ++r) {
+        readers.emplace_back([this, &shared, &done, &invalidReads]() {
+            auto guard { domain.makeGuard() };
+            while (!done.load(std::memory_order_relaxed)) {
+                const Node* node { guard.protect(shared) };
+                if (node->value < 0 || node->value > numWriters * iterationsPerThread) {
+                    invalidReads.fetch_add(1, std::memory_order_relaxed);
+                }
+                guard.clear();
+            }
+        });
+    }
+
+    for (int w { 0 }; w < numWriters; ++w) {
+        writers.emplace_back([this, w, &shared]() {
+            for (int i { 1 }; i <= iterationsPerThread; ++i) {
+                domain.retire(shared.exchange(new Node { w * iterationsPerThread + i }));
+            }
+        });
+    }
+
+    for (auto& w : writers) {
+        w.join();
+    }
+    done.store(true, std::memory_order_relaxed);
+    for (auto& r : readers) {
+        r.join();
+    }
+
+    EXPECT_EQ(invalidReads.load(), 0);
+
+    domain.retire(shared.exchange(nullptr));
+    domain.reclaim();
+    EXPECT_EQ(domain.retiredCount(), 0);
+    EXPECT_EQ(liveNodes.load(), 0);
+}
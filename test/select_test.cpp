@@ -0,0 +1,96 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "select.hpp"
+#include "spsc/queue.hpp"
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+#include <utility>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t selectQueueCapacity { 64 };
+constexpr std::size_t selectQueueCount { 4 };
+
+using SelectQueue = Blockbuster::Spsc::Queue<int, selectQueueCapacity>;
+
+class SelectorTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        for (auto& queue : queues) {
+            roundRobin.add(queue);
+            priority.add(queue);
+        }
+    }
+
+    std::array<SelectQueue, selectQueueCount> queues;
+    Blockbuster::Selector<SelectQueue> roundRobin { Blockbuster::SelectPolicy::roundRobin };
+    Blockbuster::Selector<SelectQueue> priority { Blockbuster::SelectPolicy::priority };
+};
+
+TEST_F(SelectorTest, EmptyQueues)
+{
+    EXPECT_EQ(roundRobin.size(), selectQueueCount);
+    EXPECT_FALSE(roundRobin.trySelect().has_value());
+    EXPECT_FALSE(priority.trySelect().has_value());
+}
+
+TEST_F(SelectorTest, RoundRobinIsFair)
+{
+    for (int i { 0 }; i < 3; ++i) {
+        queues[0].enqueue(i);
+        queues[2].enqueue(10 + i);
+    }
+
+    std::vector<std::pair<std::size_t, int>> selected {};
+    while (auto item { roundRobin.trySelect() }) {
+        selected.push_back(*item);
+    }
+    const std::vector<std::pair<std::size_t, int>> expected { { 0, 0 }, { 2, 10 }, { 0, 1 }, { 2, 11 }, { 0, 2 }, { 2, 12 } };
+    EXPECT_EQ(selected, expected);
+}
+
+TEST_F(SelectorTest, PriorityPrefersEarlierQueues)
+{
+    for (int i { 0 }; i < 2; ++i) {
+        queues[3].enqueue(30 + i);
+        queues[1].enqueue(10 + i);
+    }
+
+    std::vector<std::pair<std::size_t, int>> selected {};
+    while (auto item { priority.trySelect() }) {
+        selected.push_back(*item);
+    }
+    const std::vector<std::pair<std::size_t, int>> expected { { 1, 10 }, { 1, 11 }, { 3, 30 }, { 3, 31 } };
+    EXPECT_EQ(selected, expected);
+}
+
+TEST_F(SelectorTest, ParksUntilNotified)
+{
+    constexpr int itemsPerQueue { 20000 };
+
+    std::vector<std::thread> producers {};
+    for (std::size_t q { 0 }; q < selectQueueCount; ++q) {
+        producers.emplace_back([this, q]() {
+            for (int i { 0 }; i < itemsPerQueue; ++i) {
+                while (!queues[q].enqueue(i)) {
+                    std::this_thread::yield();
+                }
+                roundRobin.notify();
+            }
+        });
+    }
+
+    std::array<int, selectQueueCount> next {};
+    for (std::size_t received { 0 }; received < selectQueueCount * itemsPerQueue; ++received) {
+        const auto [index, item] { roundRobin.select() };
+        ASSERT_LT(index, selectQueueCount);
+        EXPECT_EQ(item, next[index]);
+        ++next[index];
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(roundRobin.trySelect().has_value());
+}
@@ -0,0 +1,118 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "spmc/overwrite_ring.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t ringCapacity { 16 };
+constexpr std::uint64_t concurrentPushes { 1000000 };
+
+class SpmcOverwriteRingTest : public ::testing::Test {
+protected:
+    Blockbuster::Spmc::OverwriteRing<std::uint64_t, ringCapacity> ring;
+};
+
+TEST_F(SpmcOverwriteRingTest, ReadsInOrder)
+{
+    auto reader { ring.makeReader() };
+    EXPECT_FALSE(reader.read().has_value());
+
+    for (std::uint64_t i { 0 }; i < ringCapacity; ++i) {
+        ring.push(i);
+    }
+    for (std::uint64_t i { 0 }; i < ringCapacity; ++i) {
+        EXPECT_EQ(reader.read(), i);
+    }
+    EXPECT_FALSE(reader.read().has_value());
+    EXPECT_EQ(reader.droppedCount(), 0);
+}
+
+TEST_F(SpmcOverwriteRingTest, LappedReaderSkipsToOldest)
+{
+    auto reader { ring.makeReader() };
+    constexpr std::uint64_t pushed { 2 * ringCapacity + 3 };
+    for (std::uint64_t i { 0 }; i < pushed; ++i) {
+        ring.push(i);
+    }
+    EXPECT_EQ(ring.pushedCount(), pushed);
+
+    for (std::uint64_t i { pushed - ringCapacity }; i < pushed; ++i) {
+        EXPECT_EQ(reader.read(), i);
+    }
+    EXPECT_FALSE(reader.read().has_value());
+    EXPECT_EQ(reader.droppedCount(), pushed - ringCapacity);
+}
+
+TEST_F(SpmcOverwriteRingTest, NewReaderStartsAtOldestRetained)
+{
+    for (std::uint64_t i { 0 }; i < 100; ++i) {
+        ring.push(i);
+    }
+    auto reader { ring.makeReader() };
+    EXPECT_EQ(reader.read(), 100 - ringCapacity);
+
+    auto latest { ring.makeReader() };
+    latest.skipToEnd();
+    EXPECT_FALSE(latest.read().has_value());
+    ring.push(100);
+    EXPECT_EQ(latest.read(), 100);
+}
+
+TEST_F(SpmcOverwriteRingTest, ReadersAreIndependent)
+{
+    auto first { ring.makeReader() };
+    auto second { ring.makeReader() };
+    ring.push(1);
+    ring.push(2);
+
+    EXPECT_EQ(first.read(), 1);
+    EXPECT_EQ(first.read(), 2);
+    EXPECT_EQ(second.read(), 1);
+    EXPECT_EQ(second.read(), 2);
+}
+
+TEST(SpmcOverwriteRingConcurrencyTest, ReadersNeverSeeTornEntries)
+{
+    struct Entry {
+        std::uint64_t value;
+        std::uint64_t check;
+    };
+    constexpr int readers { 2 };
+    Blockbuster::Spmc::OverwriteRing<Entry, 64> ring {};
+    std::atomic<bool> done { false };
+
+    std::vector<std::thread> threads {};
+    for (int r { 0 }; r < readers; ++r) {
+        threads.emplace_back([reader = ring.makeReader(), &done]() mutable {
+            std::uint64_t received { 0 };
+            std::uint64_t next { 0 };
+            for (;;) {
+                const bool finished { done.load(std::memory_order_acquire) };
+                if (auto entry { reader.read() }) {
+                    EXPECT_EQ(entry->check, ~entry->value);
+                    EXPECT_GE(entry->value, next);
+                    next = entry->value + 1;
+                    ++received;
+                } else if (finished) {
+                    break;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            EXPECT_EQ(received + reader.droppedCount(), concurrentPushes);
+        });
+    }
+
+    for (std::uint64_t i { 0 }; i < concurrentPushes; ++i) {
+        ring.push({ i, ~i });
+    }
+    done.store(true, std::memory_order_release);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
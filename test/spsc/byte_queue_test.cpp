@@ -0,0 +1,122 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "spsc/byte_queue.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <string>
+#include <thread>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t byteCapacity { 256 };
+
+class SpscByteQueueTest : public ::testing::Test {
+protected:
+    auto enqueueString(const std::string& text) -> bool { return queue.enqueue(text.data(), text.size()); }
+
+    auto dequeueString() -> std::optional<std::string>
+    {
+        auto record { queue.read() };
+        if (!record) {
+            return std::nullopt;
+        }
+        std::string text(reinterpret_cast<const char*>(record->data), record->size);
+        queue.release();
+        return text;
+    }
+
+    Blockbuster::Spsc::ByteQueue<byteCapacity> queue;
+};
+
+TEST_F(SpscByteQueueTest, VariableLengthRecords)
+{
+    EXPECT_TRUE(enqueueString("a"));
+    EXPECT_TRUE(enqueueString(""));
+    EXPECT_TRUE(enqueueString("a longer record of several bytes"));
+
+    EXPECT_EQ(dequeueString(), "a");
+    EXPECT_EQ(dequeueString(), "");
+    EXPECT_EQ(dequeueString(), "a longer record of several bytes");
+    EXPECT_FALSE(dequeueString().has_value());
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SpscByteQueueTest, ReserveCommitInPlace)
+{
+    std::byte* destination { queue.reserve(64) };
+    ASSERT_NE(destination, nullptr);
+    std::memcpy(destination, "abc", 3);
+    queue.commit(3);
+
+    // Headers and payloads are padded to 8 bytes only, not to the reserved size.
+    EXPECT_EQ(queue.usedBytes(), 16);
+
+    auto record { queue.read() };
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->size, 3);
+    EXPECT_EQ(std::memcmp(record->data, "abc", 3), 0);
+    queue.release();
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SpscByteQueueTest, FullAndOversized)
+{
+    EXPECT_EQ(queue.reserve(queue.maxRecordSize() + 1), nullptr);
+
+    const std::string record(queue.maxRecordSize(), 'x');
+    EXPECT_TRUE(enqueueString(record));
+    EXPECT_TRUE(enqueueString(record));
+    EXPECT_FALSE(enqueueString("y"));
+
+    EXPECT_EQ(dequeueString(), record);
+    EXPECT_TRUE(enqueueString("y"));
+}
+
+TEST_F(SpscByteQueueTest, RecordsStayContiguousAcrossWrap)
+{
+    for (int i { 0 }; i < 1000; ++i) {
+        const std::string first(static_cast<std::size_t>(i % 50), static_cast<char>('a' + i % 26));
+        const std::string second(static_cast<std::size_t>(i % 71), static_cast<char>('A' + i % 26));
+        ASSERT_TRUE(enqueueString(first));
+        ASSERT_TRUE(enqueueString(second));
+
+        for (const std::string* expected : { &first, &second }) {
+            auto record { queue.read() };
+            ASSERT_TRUE(record.has_value());
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(record->data) % 8, 0);
+            EXPECT_EQ(std::string(reinterpret_cast<const char*>(record->data), record->size), *expected);
+            queue.release();
+        }
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SpscByteQueueTest, SingleProducerAndConsumer)
+{
+    constexpr int iterations { 200000 };
+
+    std::thread producer([this]() {
+        for (int i { 0 }; i < iterations; ++i) {
+            const std::string text(std::to_string(i) + std::string(static_cast<std::size_t>(i % 37), '.'));
+            while (!enqueueString(text)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::thread consumer([this]() {
+        for (int i { 0 }; i < iterations; ++i) {
+            std::optional<std::string> text {};
+            while (!(text = dequeueString())) {
+                std::this_thread::yield();
+            }
+            EXPECT_EQ(*text, std::to_string(i) + std::string(static_cast<std::size_t>(i % 37), '.'));
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(queue.empty());
+}
@@ -1,8 +1,11 @@
 // NOLINTBEGIN(llvm-include-order)
 #include "spsc/queue.hpp"
+#include "stats.hpp"
+#include <chrono>
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <thread>
+#include <type_traits>
 // NOLINTEND(llvm-include-order)
 
 constexpr std::size_t capacity { 16 };
@@ -110,3 +113,52 @@ TEST_F(SpscQueueTest, SingleProducerAndConsumer)
 
     EXPECT_TRUE(queue.empty());
 }
+
+TEST(SpscQueueStatsTest, CountsOutcomes)
+{
+    Blockbuster::Spsc::Queue<int, 4, Blockbuster::QueueStats<>> queue {};
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.enqueue(1));
+    EXPECT_TRUE(queue.enqueue(2));
+    EXPECT_TRUE(queue.enqueue(3));
+    EXPECT_FALSE(queue.enqueue(4));
+    EXPECT_TRUE(queue.dequeue().has_value());
+
+    const Blockbuster::QueueStatsSnapshot stats { queue.stats().snapshot() };
+    EXPECT_EQ(stats.enqueued, 3);
+    EXPECT_EQ(stats.enqueueFull, 1);
+    EXPECT_EQ(stats.dequeued, 1);
+    EXPECT_EQ(stats.dequeueEmpty, 1);
+    EXPECT_EQ(stats.casRetries, 0);
+    EXPECT_EQ(stats.maxDepth, 3);
+}
+
+TEST(SpscQueueStatsTest, DisabledStatsAddNoState)
+{
+    // The buffer and the two padded cursors each take one cache line, as they did before the Stats policy existed.
+    static_assert(sizeof(Blockbuster::Spsc::Queue<int, 4>) == 3 * Blockbuster::cacheLineSize);
+    static_assert(sizeof(Blockbuster::Spsc::Queue<int, 4, Blockbuster::QueueStats<>>) > sizeof(Blockbuster::Spsc::Queue<int, 4>));
+    EXPECT_TRUE(std::is_empty_v<Blockbuster::NoStats>);
+    Blockbuster::Spsc::Queue<int, 4> queue {};
+    EXPECT_TRUE(queue.enqueue(1));
+    EXPECT_EQ(queue.stats().snapshot().enqueued, 0);
+}
+
+TEST(SpscQueueStatsTest, MeasuresQueueingLatency)
+{
+    Blockbuster::Spsc::Queue<int, 4, Blockbuster::LatencyStats<4>> queue {};
+    EXPECT_EQ(queue.stats().latency().count(), 0);
+
+    EXPECT_TRUE(queue.enqueue(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+    EXPECT_TRUE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.enqueue(2));
+    EXPECT_TRUE(queue.dequeue().has_value());
+
+    EXPECT_EQ(queue.stats().snapshot().dequeued, 2);
+    const auto latency { queue.stats().latency() };
+    EXPECT_EQ(latency.count(), 2);
+    EXPECT_LT(latency.percentile(50), 2000000);
+    EXPECT_GE(latency.percentile(100), 2000000);
+    EXPECT_EQ(latency.percentile(100), latency.max());
+}
@@ -0,0 +1,132 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "spsc/shared_queue.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+// NOLINTEND(llvm-include-order)
+
+constexpr std::size_t sharedCapacity { 64 };
+constexpr std::uint64_t sharedItems { 100000 };
+
+using SharedQueue = Blockbuster::Spsc::SharedQueue<std::uint64_t, sharedCapacity>;
+
+class SpscSharedQueueTest : public ::testing::Test {
+protected:
+    void TearDown() override { SharedQueue::unlink(name.c_str()); }
+
+    // Drains the expected sequence in a forked child and reports success through the exit status.
+    static void consumeInChild(SharedQueue& queue)
+    {
+        for (std::uint64_t expected { 0 }; expected < sharedItems;) {
+            if (auto item { queue.dequeue() }) {
+                if (*item != expected) {
+                    _exit(1);
+                }
+                ++expected;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        _exit(0);
+    }
+
+    static void produce(SharedQueue& queue)
+    {
+        for (std::uint64_t i { 0 }; i < sharedItems; ++i) {
+            while (!queue.enqueue(i)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static auto childSucceeded(pid_t child) -> bool
+    {
+        int status { 0 };
+        return waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    std::string name { "/blockbuster_test_" + std::to_string(getpid()) };
+};
+
+TEST_F(SpscSharedQueueTest, SeparateMappingsShareState)
+{
+    auto producer { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(producer.has_value());
+    auto consumer { SharedQueue::attach(name.c_str()) };
+    ASSERT_TRUE(consumer.has_value());
+
+    EXPECT_TRUE(consumer->empty());
+    EXPECT_TRUE(producer->enqueue(1));
+    EXPECT_TRUE(producer->enqueue(2));
+    EXPECT_EQ(consumer->size(), 2);
+    EXPECT_EQ(consumer->dequeue(), 1);
+    EXPECT_EQ(consumer->dequeue(), 2);
+    EXPECT_FALSE(consumer->dequeue().has_value());
+}
+
+TEST_F(SpscSharedQueueTest, FullQueue)
+{
+    auto queue { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(queue.has_value());
+
+    for (std::uint64_t i { 0 }; i < sharedCapacity - 1; ++i) {
+        EXPECT_TRUE(queue->enqueue(i));
+    }
+    EXPECT_FALSE(queue->enqueue(sharedCapacity));
+}
+
+TEST_F(SpscSharedQueueTest, CreateFailsIfNameExists)
+{
+    auto queue { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(queue.has_value());
+    EXPECT_FALSE(SharedQueue::create(name.c_str()).has_value());
+}
+
+TEST_F(SpscSharedQueueTest, AttachValidatesLayout)
+{
+    EXPECT_FALSE(SharedQueue::attach(name.c_str()).has_value());
+
+    auto queue { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(queue.has_value());
+    EXPECT_FALSE((Blockbuster::Spsc::SharedQueue<std::uint32_t, sharedCapacity>::attach(name.c_str()).has_value()));
+    EXPECT_FALSE((Blockbuster::Spsc::SharedQueue<std::uint64_t, sharedCapacity * 2>::attach(name.c_str()).has_value()));
+}
+
+TEST_F(SpscSharedQueueTest, NamedQueueAcrossProcesses)
+{
+    auto producer { SharedQueue::create(name.c_str()) };
+    ASSERT_TRUE(producer.has_value());
+
+    const pid_t child { fork() };
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        auto consumer { SharedQueue::attach(name.c_str()) };
+        if (!consumer) {
+            _exit(2);
+        }
+        consumeInChild(*consumer);
+    }
+
+    produce(*producer);
+    EXPECT_TRUE(childSucceeded(child));
+}
+
+TEST_F(SpscSharedQueueTest, AnonymousQueueAcrossProcesses)
+{
+    auto queue { SharedQueue::createAnonymous() };
+    ASSERT_TRUE(queue.has_value());
+
+    const pid_t child { fork() };
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        consumeInChild(*queue);
+    }
+
+    produce(*queue);
+    EXPECT_TRUE(childSucceeded(child));
+}
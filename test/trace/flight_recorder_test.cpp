@@ -0,0 +1,173 @@
+// NOLINTBEGIN(llvm-include-order)
+#include "mpmc/queue.hpp"
+#include "spsc/queue.hpp"
+#include "trace/flight_recorder.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+// NOLINTEND(llvm-include-order)
+
+using Blockbuster::Trace::EventKind;
+
+class TraceFlightRecorderTest : public ::testing::Test {
+protected:
+    static auto currentThreadId() -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(::syscall(SYS_gettid));
+    }
+
+    static auto findThread(std::uint64_t threadId) -> std::optional<Blockbuster::Trace::ThreadTrace>
+    {
+        for (auto& trace : Blockbuster::Trace::snapshot()) {
+            if (trace.threadId == threadId) {
+                return trace;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Returns the last count events recorded by the calling thread.
+    static auto lastEvents(std::size_t count) -> std::vector<Blockbuster::Trace::Event>
+    {
+        const auto trace { findThread(currentThreadId()) };
+        if (!trace || trace->events.size() < count) {
+            return {};
+        }
+        return { trace->events.end() - static_cast<std::ptrdiff_t>(count), trace->events.end() };
+    }
+
+    static auto kind(EventKind kind) -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(kind);
+    }
+};
+
+TEST_F(TraceFlightRecorderTest, RecordsSpscQueueOperations)
+{
+    Blockbuster::Spsc::Queue<int, 2> queue {};
+    EXPECT_TRUE(queue.enqueue(1));
+    EXPECT_FALSE(queue.enqueue(2));
+    EXPECT_EQ(queue.dequeue(), 1);
+    EXPECT_FALSE(queue.dequeue().has_value());
+
+    const auto events { lastEvents(4) };
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].kind, kind(EventKind::enqueue));
+    EXPECT_EQ(events[1].kind, kind(EventKind::enqueueFull));
+    EXPECT_EQ(events[2].kind, kind(EventKind::dequeue));
+    EXPECT_EQ(events[3].kind, kind(EventKind::dequeueEmpty));
+    for (const auto& event : events) {
+        EXPECT_EQ(event.object, reinterpret_cast<std::uintptr_t>(&queue));
+    }
+}
+
+TEST_F(TraceFlightRecorderTest, RecordsMpmcQueueOperations)
+{
+    Blockbuster::Mpmc::Queue<int, 4> queue {};
+    EXPECT_TRUE(queue.enqueue(1));
+    EXPECT_TRUE(queue.enqueue(2));
+    EXPECT_EQ(queue.dequeue(), 1);
+
+    const auto events { lastEvents(3) };
+    ASSERT_EQ(events.size(), 3);
+    EXPECT_EQ(events[0].kind, kind(EventKind::enqueue));
+    EXPECT_EQ(events[0].value, 0);
+    EXPECT_EQ(events[1].kind, kind(EventKind::enqueue));
+    EXPECT_EQ(events[1].value, 1);
+    EXPECT_EQ(events[2].kind, kind(EventKind::dequeue));
+    EXPECT_EQ(events[2].value, 0);
+    EXPECT_LE(events[0].timestamp, events[2].timestamp);
+}
+
+TEST_F(TraceFlightRecorderTest, RetainsOnlyLatestEvents)
+{
+    const auto user { kind(EventKind::user) };
+    const std::size_t count { Blockbuster::Trace::ringCapacity + 100 };
+    for (std::size_t i { 0 }; i < count; ++i) {
+        Blockbuster::Trace::record(EventKind::user, nullptr, i);
+    }
+
+    const auto trace { findThread(currentThreadId()) };
+    ASSERT_TRUE(trace.has_value());
+    ASSERT_EQ(trace->events.size(), Blockbuster::Trace::ringCapacity);
+    EXPECT_GE(trace->recordedCount, count);
+    for (std::size_t i { 0 }; i < trace->events.size(); ++i) {
+        EXPECT_EQ(trace->events[i].kind, user);
+        EXPECT_EQ(trace->events[i].value, count - Blockbuster::Trace::ringCapacity + i);
+    }
+}
+
+TEST_F(TraceFlightRecorderTest, DumpsExitedThreadsOnce)
+{
+    std::uint64_t threadId { 0 };
+    std::thread worker { [&threadId]() {
+        threadId = currentThreadId();
+        Blockbuster::Trace::record(EventKind::user, nullptr, 7);
+    } };
+    worker.join();
+
+    const auto exited { findThread(threadId) };
+    ASSERT_TRUE(exited.has_value());
+    ASSERT_EQ(exited->events.size(), 1);
+    EXPECT_EQ(exited->events[0].value, 7);
+
+    const std::string path { (std::filesystem::temp_directory_path() / ("blockbuster_trace_" + std::to_string(getpid()))).string() };
+    ASSERT_TRUE(Blockbuster::Trace::dump(path.c_str()));
+    EXPECT_FALSE(findThread(threadId).has_value());
+
+    std::FILE* file { std::fopen(path.c_str(), "rb") };
+    ASSERT_NE(file, nullptr);
+    Blockbuster::Trace::DumpHeader header {};
+    ASSERT_EQ(std::fread(&header, sizeof(header), 1, file), 1);
+    EXPECT_EQ(header.magic, Blockbuster::Trace::dumpMagic);
+    EXPECT_EQ(header.version, Blockbuster::Trace::dumpVersion);
+    EXPECT_EQ(header.eventSize, sizeof(Blockbuster::Trace::Event));
+    EXPECT_GE(header.dumpTimestamp, header.startTimestamp);
+    EXPECT_GE(header.dumpNanoseconds, header.startNanoseconds);
+
+    bool foundExited { false };
+    for (std::uint64_t t { 0 }; t < header.threadCount; ++t) {
+        Blockbuster::Trace::DumpThreadHeader threadHeader {};
+        ASSERT_EQ(std::fread(&threadHeader, sizeof(threadHeader), 1, file), 1);
+        std::vector<Blockbuster::Trace::Event> events(threadHeader.eventCount);
+        ASSERT_EQ(std::fread(events.data(), sizeof(Blockbuster::Trace::Event), events.size(), file), events.size());
+        if (threadHeader.threadId == threadId) {
+            foundExited = true;
+            ASSERT_EQ(events.size(), 1);
+            EXPECT_EQ(events[0].value, 7);
+        }
+    }
+    EXPECT_TRUE(foundExited);
+    EXPECT_EQ(std::fgetc(file), EOF);
+    std::fclose(file);
+    std::filesystem::remove(path);
+}
+
+TEST_F(TraceFlightRecorderTest, RetainsBoundedExitedThreads)
+{
+    constexpr std::size_t extra { 10 };
+    std::vector<std::uint64_t> threadIds {};
+    for (std::size_t i { 0 }; i < Blockbuster::Trace::retainedThreads + extra; ++i) {
+        std::thread worker { [&threadIds]() {
+            threadIds.push_back(currentThreadId());
+            Blockbuster::Trace::record(EventKind::user, nullptr, 0);
+        } };
+        worker.join();
+    }
+
+    // Thread ids can be reused, so this counts traces rather than distinct ids.
+    std::size_t retained { 0 };
+    for (const auto& trace : Blockbuster::Trace::snapshot()) {
+        retained += std::count(threadIds.begin(), threadIds.end(), trace.threadId) > 0 ? 1 : 0;
+    }
+    EXPECT_LE(retained, Blockbuster::Trace::retainedThreads);
+    EXPECT_TRUE(findThread(threadIds.back()).has_value());
+}